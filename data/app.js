@@ -20,8 +20,8 @@ document.getElementById('prov').addEventListener('submit', async function(e){
       status.textContent = 'Server error: ' + res.status;
       return;
     }
-    const txt = await res.text();
-    status.innerHTML = txt;
+    status.textContent = 'Saved. Connecting to ' + form.ssid.value + '...';
+    pollSaveStatus(status);
   }catch(err){
     // Fallback: some captive portals block fetch; try a plain form submit which
     // is more likely to be allowed by the browser's captive-portal handling.
@@ -33,6 +33,35 @@ document.getElementById('prov').addEventListener('submit', async function(e){
   }
 });
 
+// Follow the device's credential test after /save until it connects (and
+// restarts) or fails. The portal stays up meanwhile.
+async function pollSaveStatus(status) {
+  const deadline = Date.now() + 30000;
+  while (Date.now() < deadline) {
+    await new Promise(r => setTimeout(r, 1000));
+    let st;
+    try {
+      const res = await fetch('/save/status', { method: 'GET' });
+      if (!res.ok) continue;
+      st = await res.json();
+    } catch (e) {
+      continue; // the AP may be busy for a moment while the STA side connects
+    }
+    if (st.state === 'connecting') {
+      status.textContent = 'Connecting to ' + st.ssid + '... ' + Math.round(st.elapsed_ms / 1000) + 's';
+    } else if (st.state === 'connected') {
+      status.textContent = 'Connected to ' + st.ssid + ' as ' + st.ip +
+        '. The device restarts in a few seconds; reconnect your phone to that network.';
+      return;
+    } else if (st.state === 'failed') {
+      status.textContent = 'Could not connect to ' + st.ssid + ': ' + st.reason_text +
+        ' (reason ' + st.reason + '). Check the password and try again.';
+      return;
+    }
+  }
+  status.textContent = 'No answer from the device; it may already have restarted.';
+}
+
 // Prefill form fields from /config.json when available
 async function prefill() {
   try {
@@ -43,12 +72,38 @@ async function prefill() {
     if (cfg.devname) document.getElementById('devname').value = cfg.devname;
     if (cfg.ota_password) document.getElementById('ota_password').value = cfg.ota_password;
   if (cfg.reset_hold_seconds) document.getElementById('reset_hold_seconds').value = cfg.reset_hold_seconds;
+    for (const k of ['static_ip', 'static_gateway', 'static_subnet', 'static_dns'])
+      if (cfg[k]) document.getElementById(k).value = cfg[k];
   } catch (e) {
     // ignore
   }
 }
 
 prefill();
+
+// Offer nearby networks for the SSID field. The device scans in the
+// background; retry while the first scan is still running.
+async function loadNetworks(attempt) {
+  try {
+    const res = await fetch('/scan', { method: 'GET' });
+    if (!res.ok) return;
+    const scan = await res.json();
+    const list = document.getElementById('networks');
+    list.textContent = '';
+    for (const n of scan.networks) {
+      const opt = document.createElement('option');
+      opt.value = n.ssid;
+      opt.label = n.rssi + ' dBm' + (n.secure ? '' : ', open');
+      list.appendChild(opt);
+    }
+    if (scan.scanning && scan.networks.length === 0 && attempt < 10)
+      setTimeout(() => loadNetworks(attempt + 1), 2000);
+  } catch (e) {
+    // ignore; the field still accepts a typed SSID
+  }
+}
+
+loadNetworks(0);
 // Reset hold seconds UI behavior: show current value and enforce min/max
 const resetInput = document.getElementById('reset_hold_seconds');
 const resetDisplay = document.getElementById('resetDisplay');
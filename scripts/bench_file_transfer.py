@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""
+bench_file_transfer.py
+
+Throughput benchmark for the streaming file responder (src/file_stream.cpp).
+Downloads a LittleFS file from the STA server's /files/ endpoint repeatedly,
+checks it byte-for-byte against the local copy, then exercises Range and HEAD.
+
+Usage:
+  # 1. create a 300 KB test file under data/files/ and upload it
+  python scripts/bench_file_transfer.py --prepare 300
+  python -m platformio run -t uploadfs
+  # 2. benchmark
+  python scripts/bench_file_transfer.py 192.168.1.50
+  python scripts/bench_file_transfer.py 192.168.1.50 --runs 10 --json > after.json
+
+The test file is deterministic (seeded), so --prepare on another machine
+produces the same bytes. data/files/bench.bin is git-ignored.
+"""
+from __future__ import annotations
+
+import argparse
+import hashlib
+import http.client
+import json
+import os
+import random
+import statistics
+import sys
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+LOCAL = os.path.join(ROOT, 'data', 'files', 'bench.bin')
+REMOTE = '/files/bench.bin'
+
+
+def prepare(size_kb: int) -> int:
+    os.makedirs(os.path.dirname(LOCAL), exist_ok=True)
+    rng = random.Random(0x7B)
+    with open(LOCAL, 'wb') as f:
+        f.write(bytes(rng.getrandbits(8) for _ in range(size_kb * 1024)))
+    print(f'Wrote {LOCAL} ({size_kb} KB). Upload it with: python -m platformio run -t uploadfs')
+    return 0
+
+
+def request(host: str, port: int, method: str, path: str, headers: dict | None = None,
+            timeout: float = 30.0) -> tuple[int, dict, bytes]:
+    conn = http.client.HTTPConnection(host, port, timeout=timeout)
+    try:
+        conn.request(method, path, headers=headers or {})
+        rsp = conn.getresponse()
+        body = rsp.read()
+        return rsp.status, {k.lower(): v for k, v in rsp.getheaders()}, body
+    finally:
+        conn.close()
+
+
+def check(cond: bool, what: str, failures: list[str], verbose: bool) -> None:
+    if verbose:
+        print(f"  {'ok  ' if cond else 'FAIL'} {what}")
+    if not cond:
+        failures.append(what)
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description='Benchmark /files/ downloads (throughput, Range, HEAD)')
+    ap.add_argument('host', nargs='?', help='device IP or hostname')
+    ap.add_argument('--port', type=int, default=80)
+    ap.add_argument('--path', default=REMOTE, help=f'remote path (default {REMOTE})')
+    ap.add_argument('--runs', type=int, default=5, help='full downloads to time (default 5)')
+    ap.add_argument('--prepare', type=int, metavar='KB', help=f'create {LOCAL} of KB kilobytes and exit')
+    ap.add_argument('--json', action='store_true', help='print the result as JSON')
+    args = ap.parse_args()
+
+    if args.prepare:
+        return prepare(args.prepare)
+    if not args.host:
+        ap.error('host is required unless --prepare is given')
+
+    local = None
+    if args.path == REMOTE and os.path.exists(LOCAL):
+        with open(LOCAL, 'rb') as f:
+            local = f.read()
+
+    failures: list[str] = []
+    log = (lambda *a, **k: None) if args.json else print
+
+    status, hdrs, body = request(args.host, args.port, 'HEAD', args.path)
+    if status != 200:
+        print(f'HEAD {args.path} -> {status}; did you run --prepare and uploadfs?')
+        return 2
+    size = int(hdrs.get('content-length', '0'))
+    log(f'HEAD {args.path}: {size} bytes, Accept-Ranges: {hdrs.get("accept-ranges")}')
+
+    rates = []
+    for i in range(args.runs):
+        t0 = time.perf_counter()
+        status, hdrs, body = request(args.host, args.port, 'GET', args.path)
+        dt = time.perf_counter() - t0
+        if status != 200 or len(body) != size:
+            failures.append(f'GET run {i}: status {status}, {len(body)} bytes')
+            continue
+        if local is not None and body != local:
+            failures.append(f'GET run {i}: content mismatch (sha256 {hashlib.sha256(body).hexdigest()[:12]})')
+        rates.append(size / 1024 / dt)
+        log(f'  run {i + 1}: {dt * 1000:.0f} ms, {rates[-1]:.1f} KB/s')
+
+    if not args.json:
+        print('Range / HEAD checks:')
+    ref = local if local is not None else body
+    mid = size // 2
+    cases = [
+        ('bytes=0-1023', 0, min(1024, size)),
+        (f'bytes={mid}-', mid, size - mid),
+        ('bytes=-100', max(0, size - 100), min(100, size)),
+    ]
+    for hdr, start, length in cases:
+        status, hdrs, part = request(args.host, args.port, 'GET', args.path, {'Range': hdr})
+        ok = (status == 206 and part == ref[start:start + length] and
+              hdrs.get('content-range') == f'bytes {start}-{start + length - 1}/{size}')
+        check(ok, f'Range {hdr} -> 206 with {length} bytes', failures, not args.json)
+    status, hdrs, _ = request(args.host, args.port, 'GET', args.path, {'Range': f'bytes={size}-'})
+    ok = status == 416 and hdrs.get('content-range') == f'bytes */{size}'
+    check(ok, 'Range past EOF -> 416', failures, not args.json)
+
+    res = {
+        'host': args.host,
+        'path': args.path,
+        'size': size,
+        'runs': len(rates),
+        'kbps_mean': round(statistics.mean(rates), 1) if rates else 0.0,
+        'kbps_min': round(min(rates), 1) if rates else 0.0,
+        'kbps_max': round(max(rates), 1) if rates else 0.0,
+        'verified': local is not None,
+        'failures': failures,
+    }
+    if args.json:
+        print(json.dumps(res, indent=2))
+    else:
+        print(f"Throughput over {res['runs']} runs: mean {res['kbps_mean']} KB/s "
+              f"(min {res['kbps_min']}, max {res['kbps_max']})"
+              + ('' if res['verified'] else ' [content not verified: no local copy]'))
+        for f in failures:
+            print(f'FAIL: {f}')
+    return 1 if failures else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
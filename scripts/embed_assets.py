@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""
+embed_assets.py
+
+Minify and gzip the captive-portal UI in `data/` (index.html, app.js,
+style.css) into the generated header `src/web_assets.h`, so the firmware can
+serve it straight from flash with `Content-Encoding: gzip` and a strong ETag.
+
+Runs as a PlatformIO pre-build hook (`extra_scripts = pre:scripts/embed_assets.py`)
+and can also be run by hand:
+
+  python scripts/embed_assets.py          # regenerate src/web_assets.h if stale
+  python scripts/embed_assets.py --check  # exit 1 if src/web_assets.h is stale
+
+Output is deterministic (gzip mtime 0), and the header is only rewritten when
+its content changes, so unchanged UI files do not trigger a rebuild.
+index.html is rewritten to reference `/app.js?v=<etag>` and
+`/style.css?v=<etag>`, which lets the firmware mark those immutable.
+"""
+from __future__ import annotations
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+# (request path, file in data/, content type). index.html comes last so its
+# references to the others can be fingerprinted with their ETags.
+ASSETS = [
+    ('/app.js', 'app.js', 'application/javascript'),
+    ('/style.css', 'style.css', 'text/css'),
+    ('/', 'index.html', 'text/html'),
+]
+
+
+try:
+    Import('env')  # noqa: F821 - provided when run by PlatformIO/SCons
+    ROOT = env['PROJECT_DIR']  # noqa: F821
+except NameError:
+    ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def minify_js(text: str) -> str:
+    # Conservative: drop whole-line // comments and indentation but keep line
+    # breaks, so automatic semicolon insertion is unaffected.
+    out = []
+    for line in text.splitlines():
+        s = line.strip()
+        if not s or s.startswith('//'):
+            continue
+        out.append(s)
+    return '\n'.join(out) + '\n'
+
+
+def minify_css(text: str) -> str:
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    text = re.sub(r'\s+', ' ', text)
+    text = re.sub(r'\s*([{};:,>])\s*', r'\1', text)
+    return text.replace(';}', '}').strip() + '\n'
+
+
+def minify_html(text: str) -> str:
+    text = re.sub(r'<!--.*?-->', '', text, flags=re.S)
+    lines = [line.strip() for line in text.splitlines()]
+    return '\n'.join(line for line in lines if line) + '\n'
+
+
+MINIFIERS = {'.js': minify_js, '.css': minify_css, '.html': minify_html}
+
+
+def build(root: str) -> str:
+    data_dir = os.path.join(root, 'data')
+    etags: dict[str, str] = {}
+    entries = []
+    for path, name, ctype in ASSETS:
+        with open(os.path.join(data_dir, name), 'r', encoding='utf-8') as f:
+            text = f.read()
+        text = MINIFIERS[os.path.splitext(name)[1]](text)
+        if name == 'index.html':
+            for ref, tag in etags.items():
+                text = text.replace(f'"{ref}"', f'"{ref}?v={tag}"')
+        raw = text.encode('utf-8')
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        tag = hashlib.sha256(gz).hexdigest()[:16]
+        etags[path] = tag
+        entries.append((path, name, ctype, tag, raw, gz))
+
+    # Emit in request-path order for readability.
+    entries.sort(key=lambda e: e[0])
+    lines = [
+        '// web_assets.h',
+        '// Generated by scripts/embed_assets.py from data/. Do not edit.',
+        '#pragma once',
+        '',
+        '#include <Arduino.h>',
+        '',
+        'struct WebAsset',
+        '{',
+        '    const char *path;        // request path',
+        '    const char *contentType;',
+        '    const char *etag;        // strong ETag, quoted',
+        '    bool immutable;          // referenced with ?v=<etag>; safe to cache long-term',
+        '    const uint8_t *gz;       // gzip-compressed body in flash',
+        '    size_t gzLen;',
+        '};',
+        '',
+    ]
+    for i, (path, name, ctype, tag, raw, gz) in enumerate(entries):
+        lines.append(f'// {name}: {len(raw)} bytes minified, {len(gz)} gzipped')
+        lines.append(f'static const uint8_t WEB_ASSET_{i}[] PROGMEM = {{')
+        for off in range(0, len(gz), 16):
+            lines.append('    ' + ', '.join(f'0x{b:02x}' for b in gz[off:off + 16]) + ',')
+        lines.append('};')
+        lines.append('')
+    lines.append('static const WebAsset WEB_ASSETS[] = {')
+    for i, (path, name, ctype, tag, raw, gz) in enumerate(entries):
+        immutable = 'false' if name == 'index.html' else 'true'
+        lines.append(f'    {{"{path}", "{ctype}", "\\"{tag}\\"", {immutable}, WEB_ASSET_{i}, sizeof(WEB_ASSET_{i})}},')
+    lines.append('};')
+    lines.append('')
+    lines.append('static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);')
+    return '\n'.join(lines) + '\n'
+
+
+def main(argv: list[str]) -> int:
+    root = ROOT
+    out = os.path.join(root, 'src', 'web_assets.h')
+    content = build(root)
+    current = None
+    if os.path.exists(out):
+        with open(out, 'r', encoding='utf-8') as f:
+            current = f.read()
+    if current == content:
+        print('embed_assets: src/web_assets.h up to date')
+        return 0
+    if '--check' in argv:
+        print('embed_assets: src/web_assets.h is stale; run python scripts/embed_assets.py')
+        return 1
+    with open(out, 'w', encoding='utf-8', newline='\n') as f:
+        f.write(content)
+    print('embed_assets: regenerated src/web_assets.h')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
+else:
+    # Imported by PlatformIO as a pre: extra script.
+    main([])
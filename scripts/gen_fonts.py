@@ -0,0 +1,418 @@
+#!/usr/bin/env python3
+"""
+gen_fonts.py
+
+Rasterize the OLED fonts from TrueType files into the generated header
+`src/font_data.h`: printable ASCII at a few fixed line heights, packed in the
+SSD1306 page-major layout (one byte = 8 vertical pixels, LSB on top, a glyph
+is `pages` rows of `width` column bytes), so the firmware blits glyphs into
+the framebuffer byte by byte (src/fonts.cpp) instead of scaling the 5x7 GFX
+font pixel by pixel. Per-glyph advance and ink offset are kept, so text width
+is measured exactly.
+
+Needs only the Python standard library (a small TrueType outline parser and a
+supersampling scanline rasterizer). The header is committed, so the build does
+not depend on this script or on the font files; rerun it after changing FONTS:
+
+  python scripts/gen_fonts.py                  # regenerate src/font_data.h if stale
+  python scripts/gen_fonts.py --check          # exit 1 if src/font_data.h is stale
+  python scripts/gen_fonts.py --preview "Menu" # print text in each font as ASCII art
+  python scripts/gen_fonts.py --font-dir DIR   # look for the .ttf files in DIR
+
+Output is deterministic and only rewritten when its content changes.
+"""
+from __future__ import annotations
+
+import math
+import os
+import struct
+import sys
+
+# (C name, TrueType file, line height in 8-pixel pages). The pixel size is the
+# largest at which every glyph of FIRST..LAST fits the line.
+FONTS = [
+    ('FONT_SANS_16', 'DejaVuSans-Bold.ttf', 2),
+    ('FONT_SANS_24', 'DejaVuSans-Bold.ttf', 3),
+]
+FIRST, LAST = 0x20, 0x7E
+FONT_DIRS = [
+    '/usr/share/fonts/truetype/dejavu',
+    '/usr/share/fonts/TTF',
+    '/Library/Fonts',
+    os.path.expanduser('~/.fonts'),
+    os.path.expanduser('~/Library/Fonts'),
+]
+# Subsamples per pixel side; a pixel is lit when at least half is covered.
+SUPERSAMPLE = 4
+CURVE_STEPS = 6
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+class TrueType:
+    """The parts of a TrueType file needed to rasterize glyph outlines."""
+
+    def __init__(self, data: bytes):
+        self.data = data
+        num = struct.unpack_from('>H', data, 4)[0]
+        self.tables = {}
+        for i in range(num):
+            tag, _, off, length = struct.unpack_from('>4sIII', data, 12 + 16 * i)
+            self.tables[tag.decode('latin-1')] = (off, length)
+        head = self.tables['head'][0]
+        self.units_per_em = struct.unpack_from('>H', data, head + 18)[0]
+        self.long_loca = struct.unpack_from('>h', data, head + 50)[0] == 1
+        self.num_glyphs = struct.unpack_from('>H', data, self.tables['maxp'][0] + 4)[0]
+        self.num_hmetrics = struct.unpack_from('>H', data, self.tables['hhea'][0] + 34)[0]
+        self.cmap = self._read_cmap()
+
+    def _read_cmap(self) -> dict[int, int]:
+        base = self.tables['cmap'][0]
+        count = struct.unpack_from('>H', self.data, base + 2)[0]
+        for i in range(count):
+            platform, encoding, off = struct.unpack_from('>HHI', self.data, base + 4 + 8 * i)
+            sub = base + off
+            if (platform, encoding) in ((3, 1), (0, 3)) and struct.unpack_from('>H', self.data, sub)[0] == 4:
+                return self._read_cmap4(sub)
+        raise ValueError('no Unicode BMP (format 4) cmap')
+
+    def _read_cmap4(self, sub: int) -> dict[int, int]:
+        seg2 = struct.unpack_from('>H', self.data, sub + 6)[0]
+        ends = sub + 14
+        starts = ends + seg2 + 2
+        deltas = starts + seg2
+        ranges = deltas + seg2
+        out = {}
+        for s in range(seg2 // 2):
+            end = struct.unpack_from('>H', self.data, ends + 2 * s)[0]
+            start = struct.unpack_from('>H', self.data, starts + 2 * s)[0]
+            delta = struct.unpack_from('>h', self.data, deltas + 2 * s)[0]
+            range_off = struct.unpack_from('>H', self.data, ranges + 2 * s)[0]
+            for c in range(max(start, FIRST), min(end, LAST) + 1):
+                if range_off == 0:
+                    out[c] = (c + delta) & 0xFFFF
+                else:
+                    at = ranges + 2 * s + range_off + 2 * (c - start)
+                    g = struct.unpack_from('>H', self.data, at)[0]
+                    out[c] = (g + delta) & 0xFFFF if g else 0
+        return out
+
+    def advance(self, glyph: int) -> int:
+        hmtx = self.tables['hmtx'][0]
+        i = min(glyph, self.num_hmetrics - 1)
+        return struct.unpack_from('>H', self.data, hmtx + 4 * i)[0]
+
+    def _glyph_offset(self, glyph: int) -> tuple[int, int]:
+        loca = self.tables['loca'][0]
+        if self.long_loca:
+            a, b = struct.unpack_from('>II', self.data, loca + 4 * glyph)
+        else:
+            a, b = (2 * v for v in struct.unpack_from('>HH', self.data, loca + 2 * glyph))
+        return self.tables['glyf'][0] + a, b - a
+
+    def contours(self, glyph: int) -> list[list[tuple[float, float, bool]]]:
+        """Outline contours as (x, y, on_curve) points in font units."""
+        off, length = self._glyph_offset(glyph)
+        if length == 0:
+            return []
+        n = struct.unpack_from('>h', self.data, off)[0]
+        if n >= 0:
+            return self._simple(off, n)
+        return self._composite(off)
+
+    def _simple(self, off: int, n: int):
+        p = off + 10
+        ends = struct.unpack_from(f'>{n}H', self.data, p)
+        p += 2 * n
+        p += 2 + struct.unpack_from('>H', self.data, p)[0]  # skip instructions
+        count = ends[-1] + 1 if n else 0
+        flags = []
+        while len(flags) < count:
+            f = self.data[p]
+            p += 1
+            flags.append(f)
+            if f & 8:
+                flags.extend([f] * self.data[p])
+                p += 1
+        coords = []
+        for short, same in ((2, 16), (4, 32)):
+            v, vals = 0, []
+            for f in flags:
+                if f & short:
+                    d = self.data[p]
+                    p += 1
+                    v += d if f & same else -d
+                elif not f & same:
+                    v += struct.unpack_from('>h', self.data, p)[0]
+                    p += 2
+                vals.append(v)
+            coords.append(vals)
+        pts = [(x, y, bool(f & 1)) for x, y, f in zip(coords[0], coords[1], flags)]
+        out, start = [], 0
+        for e in ends:
+            out.append(pts[start:e + 1])
+            start = e + 1
+        return out
+
+    def _composite(self, off: int):
+        p = off + 10
+        out = []
+        while True:
+            flags, glyph = struct.unpack_from('>HH', self.data, p)
+            p += 4
+            if flags & 1:
+                dx, dy = struct.unpack_from('>hh', self.data, p)
+                p += 4
+            else:
+                dx, dy = struct.unpack_from('>bb', self.data, p)
+                p += 2
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 8:
+                a = d = struct.unpack_from('>h', self.data, p)[0] / 16384
+                p += 2
+            elif flags & 0x40:
+                a, d = (v / 16384 for v in struct.unpack_from('>hh', self.data, p))
+                p += 4
+            elif flags & 0x80:
+                a, b, c, d = (v / 16384 for v in struct.unpack_from('>hhhh', self.data, p))
+                p += 8
+            if not flags & 2:
+                dx = dy = 0  # point matching is not used by the fonts we pack
+            for contour in self.contours(glyph):
+                out.append([(a * x + c * y + dx, b * x + d * y + dy, on) for x, y, on in contour])
+            if not flags & 0x20:
+                return out
+
+
+def flatten(contour):
+    """Turn a quadratic B-spline contour into a closed polygon."""
+    if not contour:
+        return []
+    pts = list(contour)
+    # Start on an on-curve point, inserting the implied midpoint if none.
+    k = next((i for i, p in enumerate(pts) if p[2]), None)
+    if k is None:
+        a, b = pts[-1], pts[0]
+        pts.insert(0, ((a[0] + b[0]) / 2, (a[1] + b[1]) / 2, True))
+        k = 0
+    pts = pts[k:] + pts[:k]
+    poly = [(pts[0][0], pts[0][1])]
+    prev = pts[0]
+    ctrl = None
+    for p in pts[1:] + [pts[0]]:
+        if p[2]:
+            if ctrl is None:
+                poly.append((p[0], p[1]))
+            else:
+                poly.extend(quad(prev, ctrl, p))
+                ctrl = None
+            prev = p
+        elif ctrl is None:
+            ctrl = p
+        else:
+            mid = ((ctrl[0] + p[0]) / 2, (ctrl[1] + p[1]) / 2, True)
+            poly.extend(quad(prev, ctrl, mid))
+            prev, ctrl = mid, p
+    return poly
+
+
+def quad(a, c, b):
+    out = []
+    for i in range(1, CURVE_STEPS + 1):
+        t = i / CURVE_STEPS
+        u = 1 - t
+        out.append((u * u * a[0] + 2 * u * t * c[0] + t * t * b[0], u * u * a[1] + 2 * u * t * c[1] + t * t * b[1]))
+    return out
+
+
+def rasterize(polys, scale, baseline, rows, x0, cols):
+    """Coverage-thresholded bitmap (rows x cols) of the polygons, nonzero
+    winding. Pixel column 0 is at pen x0, row `baseline` sits on the baseline."""
+    edges = []
+    for poly in polys:
+        for i in range(len(poly)):
+            (ax, ay), (bx, by) = poly[i - 1], poly[i]
+            ax, bx = ax * scale - x0, bx * scale - x0
+            ay, by = baseline - ay * scale, baseline - by * scale  # pixel rows grow downwards
+            if ay != by:
+                edges.append((ax, ay, bx, by))
+    ss = SUPERSAMPLE
+    cover = [[0] * cols for _ in range(rows)]
+    for r in range(rows):
+        for sy in range(ss):
+            y = r + (sy + 0.5) / ss
+            crossings = []
+            for ax, ay, bx, by in edges:
+                if (ay <= y < by) or (by <= y < ay):
+                    x = ax + (y - ay) * (bx - ax) / (by - ay)
+                    crossings.append((x, 1 if by > ay else -1))
+            crossings.sort()
+            wind = 0
+            for i, (x, w) in enumerate(crossings):
+                was = wind
+                wind += w
+                if was != 0 and i:
+                    fill_span(cover[r], crossings[i - 1][0], x, ss)
+    limit = ss * ss / 2
+    return [[1 if c >= limit else 0 for c in row] for row in cover]
+
+
+def fill_span(row, xa, xb, ss):
+    # Count subsample centers (i + (k + 0.5) / ss) inside [xa, xb).
+    start = max(0, math.ceil(xa * ss - 0.5))
+    end = min(len(row) * ss, math.ceil(xb * ss - 0.5))
+    for s in range(start, end):
+        row[s // ss] += 1
+
+
+def glyph_bbox(font: TrueType, glyph: int):
+    polys = [flatten(c) for c in font.contours(glyph)]
+    pts = [p for poly in polys for p in poly]
+    if not pts:
+        return polys, None
+    return polys, (min(p[0] for p in pts), min(p[1] for p in pts), max(p[0] for p in pts), max(p[1] for p in pts))
+
+
+def pack_font(font: TrueType, pages: int):
+    """Pick the pixel size and rasterize FIRST..LAST. Returns a dict."""
+    height = pages * 8
+    outlines = {}
+    for c in range(FIRST, LAST + 1):
+        g = font.cmap.get(c, 0)
+        outlines[c] = (g,) + glyph_bbox(font, g)
+    top = max(b[3] for _, _, b in outlines.values() if b)
+    bottom = min(b[1] for _, _, b in outlines.values() if b)
+    ppem = 4
+    while math.ceil((top - bottom) * (ppem + 1) / font.units_per_em) <= height:
+        ppem += 1
+    scale = ppem / font.units_per_em
+    ascent = math.ceil(top * scale)
+    # Keep descenders inside the line; what is left over goes on top.
+    baseline = min(height - math.ceil(-bottom * scale), height)
+    baseline = max(baseline, ascent)
+
+    glyphs = []
+    bitmap = bytearray()
+    for c in range(FIRST, LAST + 1):
+        g, polys, bbox = outlines[c]
+        advance = round(font.advance(g) * scale)
+        if not bbox:
+            glyphs.append((len(bitmap), 0, 0, advance))
+            continue
+        x0 = math.floor(bbox[0] * scale)
+        cols = math.ceil(bbox[2] * scale) - x0 + 1
+        img = rasterize(polys, scale, baseline, height, x0, cols)
+        used = [x for x in range(cols) if any(img[r][x] for r in range(height))]
+        if not used:
+            glyphs.append((len(bitmap), 0, 0, advance))
+            continue
+        lo, hi = used[0], used[-1] + 1
+        offset = len(bitmap)
+        for p in range(pages):
+            for x in range(lo, hi):
+                b = 0
+                for bit in range(8):
+                    if img[p * 8 + bit][x]:
+                        b |= 1 << bit
+                bitmap.append(b)
+        glyphs.append((offset, hi - lo, x0 + lo, advance))
+    return {'ppem': ppem, 'pages': pages, 'baseline': baseline, 'glyphs': glyphs, 'bitmap': bytes(bitmap)}
+
+
+def find_font(name: str, dirs: list[str]) -> str:
+    for d in dirs:
+        path = os.path.join(d, name)
+        if os.path.exists(path):
+            return path
+    raise FileNotFoundError(f'{name} not found in {", ".join(dirs)}; pass --font-dir')
+
+
+def build(dirs: list[str]) -> tuple[str, dict]:
+    packed = {}
+    cache = {}
+    for cname, ttf, pages in FONTS:
+        if ttf not in cache:
+            with open(find_font(ttf, dirs), 'rb') as f:
+                cache[ttf] = TrueType(f.read())
+        packed[cname] = pack_font(cache[ttf], pages)
+
+    lines = [
+        '// font_data.h',
+        '// Generated by scripts/gen_fonts.py from DejaVu Sans (Bitstream Vera',
+        '// license, free to embed). Do not edit.',
+        '#pragma once',
+        '',
+        '#include <Arduino.h>',
+        '#include "fonts.h"',
+        '',
+    ]
+    for cname, ttf, pages in FONTS:
+        p = packed[cname]
+        bm = p['bitmap']
+        lname = cname.lower()
+        lines.append(f'// {ttf} at {p["ppem"]} px per em, {pages * 8} px line, baseline at row {p["baseline"]}: '
+                     f'{len(bm)} bytes of glyphs')
+        lines.append(f'static const uint8_t {lname}_bitmap[] PROGMEM = {{')
+        for off in range(0, len(bm), 16):
+            lines.append('    ' + ', '.join(f'0x{b:02x}' for b in bm[off:off + 16]) + ',')
+        lines.append('};')
+        lines.append('')
+        lines.append(f'static const FontGlyph {lname}_glyphs[] PROGMEM = {{')
+        for c, (offset, width, xoff, adv) in zip(range(FIRST, LAST + 1), p['glyphs']):
+            ch = {' ': 'space', '\\': 'backslash'}.get(chr(c), chr(c))
+            lines.append(f'    {{{offset}, {width}, {xoff}, {adv}}}, // {ch}')
+        lines.append('};')
+        lines.append('')
+        lines.append(f'const Font {cname} = {{{lname}_bitmap, {lname}_glyphs, 0x{FIRST:02x}, 0x{LAST:02x}, '
+                     f'{pages}, {p["baseline"]}}};')
+        lines.append('')
+    return '\n'.join(lines), packed
+
+
+def preview(packed: dict, text: str) -> None:
+    for cname, _, pages in FONTS:
+        p = packed[cname]
+        rows = [''] * (pages * 8)
+        for ch in text:
+            c = ord(ch) if FIRST <= ord(ch) <= LAST else ord('?')
+            offset, width, xoff, adv = p['glyphs'][c - FIRST]
+            cell = [[' '] * max(adv, xoff + width) for _ in rows]
+            for pg in range(pages):
+                for x in range(width):
+                    b = p['bitmap'][offset + pg * width + x]
+                    for bit in range(8):
+                        if b >> bit & 1 and 0 <= xoff + x:
+                            cell[pg * 8 + bit][xoff + x] = '#'
+            for r in range(len(rows)):
+                rows[r] += ''.join(cell[r][:max(adv, 1)])
+        print(f'{cname} ({p["ppem"]} px/em):')
+        print('\n'.join(r.rstrip() for r in rows))
+
+
+def main(argv: list[str]) -> int:
+    dirs = list(FONT_DIRS)
+    if '--font-dir' in argv:
+        dirs.insert(0, argv[argv.index('--font-dir') + 1])
+    content, packed = build(dirs)
+    if '--preview' in argv:
+        preview(packed, argv[argv.index('--preview') + 1])
+        return 0
+    out = os.path.join(ROOT, 'src', 'font_data.h')
+    current = None
+    if os.path.exists(out):
+        with open(out, 'r', encoding='utf-8') as f:
+            current = f.read()
+    if current == content:
+        print('gen_fonts: src/font_data.h up to date')
+        return 0
+    if '--check' in argv:
+        print('gen_fonts: src/font_data.h is stale; run python scripts/gen_fonts.py')
+        return 1
+    with open(out, 'w', encoding='utf-8', newline='\n') as f:
+        f.write(content)
+    print('gen_fonts: regenerated src/font_data.h')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
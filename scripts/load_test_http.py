@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""
+load_test_http.py
+
+Hammer the device's STA-mode HTTP server with N concurrent scrapers and report
+latency percentiles. Each worker keeps one HTTP/1.1 keep-alive connection
+open (reconnecting when the server closes it) and requests the given paths
+round-robin for the test duration.
+
+Usage:
+  python scripts/load_test_http.py 192.168.1.50
+  python scripts/load_test_http.py thermabridge.local --clients 20 --duration 30
+  python scripts/load_test_http.py 192.168.1.50 --paths /status /health --etag
+  python scripts/load_test_http.py 192.168.1.50 --json > after.json
+  python scripts/load_test_http.py 192.168.1.50 --heap --duration 600
+
+To compare two firmware builds, run the same command against each and keep
+the --json output; `--compare before.json` prints the deltas next to the new
+numbers. --heap samples /health before and after the run and reports the
+drift of free_heap, max_alloc_heap (largest allocatable block) and
+min_free_heap, which shows per-request allocations fragmenting the heap.
+Standard library only.
+"""
+from __future__ import annotations
+
+import argparse
+import http.client
+import json
+import socket
+import sys
+import threading
+import time
+
+
+def percentile(sorted_vals: list[float], p: float) -> float:
+    if not sorted_vals:
+        return 0.0
+    k = (len(sorted_vals) - 1) * p / 100.0
+    lo = int(k)
+    hi = min(lo + 1, len(sorted_vals) - 1)
+    return sorted_vals[lo] + (sorted_vals[hi] - sorted_vals[lo]) * (k - lo)
+
+
+class Worker(threading.Thread):
+    def __init__(self, host: str, port: int, paths: list[str], deadline: float,
+                 timeout: float, use_etag: bool):
+        super().__init__(daemon=True)
+        self.host = host
+        self.port = port
+        self.paths = paths
+        self.deadline = deadline
+        self.timeout = timeout
+        self.use_etag = use_etag
+        self.latencies: list[float] = []
+        self.errors = 0
+        self.reconnects = 0
+        self.not_modified = 0
+        self.etags: dict[str, str] = {}
+
+    def _connect(self) -> http.client.HTTPConnection:
+        conn = http.client.HTTPConnection(self.host, self.port, timeout=self.timeout)
+        conn.connect()
+        conn.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        return conn
+
+    def run(self) -> None:
+        conn = None
+        i = 0
+        while time.monotonic() < self.deadline:
+            path = self.paths[i % len(self.paths)]
+            i += 1
+            headers = {'Connection': 'keep-alive'}
+            if self.use_etag and path in self.etags:
+                headers['If-None-Match'] = self.etags[path]
+            t0 = time.perf_counter()
+            try:
+                if conn is None:
+                    conn = self._connect()
+                    self.reconnects += 1
+                conn.request('GET', path, headers=headers)
+                rsp = conn.getresponse()
+                rsp.read()
+                elapsed = (time.perf_counter() - t0) * 1000.0
+                if rsp.status == 304:
+                    self.not_modified += 1
+                elif rsp.status != 200:
+                    self.errors += 1
+                    continue
+                etag = rsp.getheader('ETag')
+                if etag:
+                    self.etags[path] = etag
+                self.latencies.append(elapsed)
+                if rsp.will_close:
+                    conn.close()
+                    conn = None
+            except (OSError, http.client.HTTPException):
+                self.errors += 1
+                if conn is not None:
+                    conn.close()
+                conn = None
+        if conn is not None:
+            conn.close()
+
+
+HEAP_KEYS = ('free_heap', 'max_alloc_heap', 'min_free_heap')
+
+
+def sample_heap(host: str, port: int, timeout: float) -> dict | None:
+    try:
+        conn = http.client.HTTPConnection(host, port, timeout=timeout)
+        conn.request('GET', '/health')
+        rsp = conn.getresponse()
+        body = rsp.read()
+        conn.close()
+        if rsp.status != 200:
+            return None
+        health = json.loads(body)
+        return {k: health[k] for k in HEAP_KEYS if k in health}
+    except (OSError, http.client.HTTPException, ValueError):
+        return None
+
+
+def run(args: argparse.Namespace) -> dict:
+    heap_before = sample_heap(args.host, args.port, args.timeout) if args.heap else None
+    deadline = time.monotonic() + args.duration
+    workers = [Worker(args.host, args.port, args.paths, deadline, args.timeout, args.etag)
+               for _ in range(args.clients)]
+    start = time.monotonic()
+    for w in workers:
+        w.start()
+    for w in workers:
+        w.join()
+    wall = time.monotonic() - start
+
+    lat = sorted(v for w in workers for v in w.latencies)
+    errors = sum(w.errors for w in workers)
+    res = {
+        'host': args.host,
+        'clients': args.clients,
+        'duration_s': round(wall, 2),
+        'paths': args.paths,
+        'requests': len(lat),
+        'errors': errors,
+        'connections': sum(w.reconnects for w in workers),
+        'not_modified': sum(w.not_modified for w in workers),
+        'rps': round(len(lat) / wall, 1) if wall > 0 else 0.0,
+        'p50_ms': round(percentile(lat, 50), 1),
+        'p90_ms': round(percentile(lat, 90), 1),
+        'p99_ms': round(percentile(lat, 99), 1),
+        'max_ms': round(lat[-1], 1) if lat else 0.0,
+    }
+    if args.heap:
+        # Let the server settle so in-flight buffers are released.
+        time.sleep(1.0)
+        heap_after = sample_heap(args.host, args.port, args.timeout)
+        if heap_before and heap_after:
+            for k in HEAP_KEYS:
+                if k in heap_before and k in heap_after:
+                    res[k + '_drift'] = heap_after[k] - heap_before[k]
+    return res
+
+
+def print_report(res: dict, before: dict | None) -> None:
+    print(f"{res['clients']} clients, {res['duration_s']} s, paths {' '.join(res['paths'])}")
+    for key in ('requests', 'errors', 'connections', 'not_modified', 'rps',
+                'p50_ms', 'p90_ms', 'p99_ms', 'max_ms') + tuple(k + '_drift' for k in HEAP_KEYS):
+        if key not in res:
+            continue
+        line = f'  {key:<22}{res[key]:>10}'
+        if before is not None and key in before:
+            line += f'   (before {before[key]}, delta {round(res[key] - before[key], 1):+})'
+        print(line)
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description='Concurrent keep-alive load test for the status server')
+    ap.add_argument('host', help='device IP or hostname')
+    ap.add_argument('--port', type=int, default=80)
+    ap.add_argument('--clients', type=int, default=20, help='concurrent connections (default 20)')
+    ap.add_argument('--duration', type=float, default=20.0, help='seconds to run (default 20)')
+    ap.add_argument('--timeout', type=float, default=5.0, help='per-request socket timeout')
+    ap.add_argument('--paths', nargs='+', default=['/status', '/health'])
+    ap.add_argument('--etag', action='store_true', help='send If-None-Match with the last ETag seen')
+    ap.add_argument('--heap', action='store_true', help='report /health heap drift over the run')
+    ap.add_argument('--json', action='store_true', help='print the result as JSON')
+    ap.add_argument('--compare', metavar='FILE', help='JSON result of a previous run to diff against')
+    args = ap.parse_args()
+
+    res = run(args)
+    if args.json:
+        print(json.dumps(res, indent=2))
+        return 0
+    before = None
+    if args.compare:
+        with open(args.compare, 'r', encoding='utf-8') as f:
+            before = json.load(f)
+    print_report(res, before)
+    return 1 if res['requests'] == 0 else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
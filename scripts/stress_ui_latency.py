@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""
+stress_ui_latency.py
+
+Show that STA HTTP latency does not depend on display load. Runs the
+load_test_http.py scraper twice against the device: once with the UI idle and
+once while the display is redrawn and flushed continuously (POST
+/debug/ui-stress), then compares the latency percentiles. The network services
+and the display run on different cores (src/cores.h), so the two runs should
+match within noise.
+
+Needs a firmware built with the stress hook:
+  build_flags = -DTB_UI_STRESS      (platformio.ini)
+
+Usage:
+  python scripts/stress_ui_latency.py 192.168.1.50
+  python scripts/stress_ui_latency.py thermabridge.local --duration 30 --clients 10
+  python scripts/stress_ui_latency.py 192.168.1.50 --json > stress.json
+
+Exits 1 when the stressed p99 exceeds the idle p99 by more than --tolerance-ms
+(default 20 ms) or requests fail; 2 when the stress hook is missing.
+Standard library only.
+"""
+from __future__ import annotations
+
+import argparse
+import http.client
+import json
+import os
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import load_test_http  # noqa: E402
+
+
+def set_stress(host: str, port: int, seconds: int, timeout: float) -> int:
+    conn = http.client.HTTPConnection(host, port, timeout=timeout)
+    try:
+        conn.request('POST', f'/debug/ui-stress?seconds={seconds}')
+        rsp = conn.getresponse()
+        rsp.read()
+        return rsp.status
+    finally:
+        conn.close()
+
+
+def phase(args: argparse.Namespace) -> dict:
+    ns = argparse.Namespace(host=args.host, port=args.port, clients=args.clients,
+                            duration=args.duration, timeout=args.timeout,
+                            paths=args.paths, etag=False, heap=False)
+    return load_test_http.run(ns)
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description='HTTP latency with and without continuous display redraws')
+    ap.add_argument('host', help='device IP or hostname')
+    ap.add_argument('--port', type=int, default=80)
+    ap.add_argument('--clients', type=int, default=10, help='concurrent connections (default 10)')
+    ap.add_argument('--duration', type=float, default=20.0, help='seconds per phase (default 20)')
+    ap.add_argument('--timeout', type=float, default=5.0, help='per-request socket timeout')
+    ap.add_argument('--paths', nargs='+', default=['/status', '/health'])
+    ap.add_argument('--tolerance-ms', type=float, default=20.0,
+                    help='allowed p99 increase under stress (default 20)')
+    ap.add_argument('--json', action='store_true', help='print both results as JSON')
+    args = ap.parse_args()
+
+    try:
+        status = set_stress(args.host, args.port, 0, args.timeout)
+    except OSError as e:
+        print(f'cannot reach {args.host}: {e}')
+        return 2
+    if status != 200:
+        print(f'POST /debug/ui-stress -> {status}; build with -DTB_UI_STRESS')
+        return 2
+
+    idle = phase(args)
+    set_stress(args.host, args.port, int(args.duration) + 5, args.timeout)
+    time.sleep(0.5)  # let the redraw loop get going
+    try:
+        stressed = phase(args)
+    finally:
+        set_stress(args.host, args.port, 0, args.timeout)
+
+    delta = stressed['p99_ms'] - idle['p99_ms']
+    ok = stressed['errors'] == 0 and stressed['requests'] > 0 and delta <= args.tolerance_ms
+    if args.json:
+        print(json.dumps({'idle': idle, 'stressed': stressed, 'p99_delta_ms': round(delta, 1), 'pass': ok},
+                         indent=2))
+    else:
+        print('UI idle:')
+        load_test_http.print_report(idle, None)
+        print('Display redrawing continuously:')
+        load_test_http.print_report(stressed, idle)
+        print(f"p99 delta {delta:+.1f} ms (tolerance {args.tolerance_ms} ms): {'PASS' if ok else 'FAIL'}")
+    return 0 if ok else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
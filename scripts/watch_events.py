@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""
+watch_events.py
+
+Tail the STA server's GET /events Server-Sent Events stream and print the
+device state as it changes. Each update only carries the fields that changed;
+this script merges them into the snapshot it got on connect.
+
+Usage:
+  python scripts/watch_events.py 192.168.1.50
+  python scripts/watch_events.py ThermaBridge.local --raw       # print frames as received
+  python scripts/watch_events.py 192.168.1.50 --duration 60 --json > events.json
+"""
+from __future__ import annotations
+
+import argparse
+import http.client
+import json
+import sys
+import time
+
+
+def frames(rsp):
+    """Yield (event, data) pairs; comment lines (keep-alives) yield ('', None)."""
+    event, data = 'message', []
+    while True:
+        line = rsp.readline()
+        if not line:
+            return
+        line = line.decode('utf-8', 'replace').rstrip('\r\n')
+        if line == '':
+            if data:
+                yield event, '\n'.join(data)
+            event, data = 'message', []
+        elif line.startswith(':'):
+            yield '', None
+        elif line.startswith('event:'):
+            event = line[6:].strip()
+        elif line.startswith('data:'):
+            data.append(line[5:].lstrip())
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description='Tail GET /events from a ThermaBridge device')
+    ap.add_argument('host', help='device IP or hostname')
+    ap.add_argument('--port', type=int, default=80)
+    ap.add_argument('--duration', type=float, default=0, help='stop after N seconds (default: run until Ctrl-C)')
+    ap.add_argument('--raw', action='store_true', help='print each frame instead of the merged state')
+    ap.add_argument('--json', action='store_true', help='print all received events as one JSON list at the end')
+    args = ap.parse_args()
+
+    conn = http.client.HTTPConnection(args.host, args.port, timeout=60)
+    conn.request('GET', '/events', headers={'Accept': 'text/event-stream'})
+    rsp = conn.getresponse()
+    if rsp.status != 200:
+        print(f'GET /events -> {rsp.status}: {rsp.read().decode(errors="replace")}')
+        return 2
+
+    state: dict = {}
+    log: list = []
+    t0 = time.monotonic()
+    try:
+        for event, data in frames(rsp):
+            if args.duration and time.monotonic() - t0 >= args.duration:
+                break
+            if data is None:
+                if args.raw:
+                    print(f'{time.monotonic() - t0:7.1f}s  (keep-alive)')
+                continue
+            fields = json.loads(data)
+            log.append({'t': round(time.monotonic() - t0, 3), 'event': event, 'data': fields})
+            if event == 'snapshot':
+                state = dict(fields)
+            else:
+                state.update(fields)
+            if args.json:
+                continue
+            shown = fields if args.raw else state
+            print(f'{time.monotonic() - t0:7.1f}s  {event:8s} {json.dumps(shown, separators=(",", ":"))}')
+    except KeyboardInterrupt:
+        pass
+    finally:
+        conn.close()
+    if args.json:
+        print(json.dumps(log, indent=2))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
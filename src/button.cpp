@@ -0,0 +1,86 @@
+#include "button.h"
+
+void ButtonGestures::emit(ButtonGesture g, uint32_t atMs, uint32_t heldMs)
+{
+    ButtonEvent ev = {g, atMs, heldMs};
+    events.push(ev);
+}
+
+void ButtonGestures::update(bool down, uint32_t nowMs)
+{
+    if (down != raw)
+    {
+        raw = down;
+        rawSince = nowMs;
+    }
+    // The debounced edge is dated to the raw edge, not to when it settled,
+    // so hold durations do not depend on the sampling rate.
+    if (raw != stable && nowMs - rawSince >= BUTTON_DEBOUNCE_MS)
+    {
+        stable = raw;
+        if (stable)
+            pressed(rawSince);
+        else
+            released(rawSince);
+    }
+
+    if (stable)
+    {
+        uint32_t held = nowMs - downAt;
+        if (!isHolding && held >= BUTTON_HOLD_MS)
+        {
+            // A click just before the hold stands on its own.
+            if (clickPending)
+            {
+                clickPending = false;
+                emit(ButtonGesture::Press, nowMs);
+            }
+            isHolding = true;
+            emit(ButtonGesture::HoldStart, nowMs, held);
+        }
+        if (isHolding && !longFired && held >= longHoldMs)
+        {
+            longFired = true;
+            emit(ButtonGesture::LongHold, nowMs, held);
+        }
+    }
+    else if (clickPending && nowMs - releasedAt >= BUTTON_DOUBLE_GAP_MS &&
+             (!raw || rawSince - releasedAt >= BUTTON_DOUBLE_GAP_MS))
+    {
+        // The gap is over, and no second press that began inside it is
+        // still settling: it was a single press.
+        clickPending = false;
+        emit(ButtonGesture::Press, nowMs);
+    }
+}
+
+void ButtonGestures::pressed(uint32_t atMs)
+{
+    if (clickPending && atMs - releasedAt >= BUTTON_DOUBLE_GAP_MS)
+    {
+        clickPending = false;
+        emit(ButtonGesture::Press, atMs);
+    }
+    downAt = atMs;
+    isHolding = false;
+    longFired = false;
+}
+
+void ButtonGestures::released(uint32_t atMs)
+{
+    if (isHolding)
+    {
+        isHolding = false;
+        emit(ButtonGesture::HoldEnd, atMs, atMs - downAt);
+    }
+    else if (clickPending)
+    {
+        clickPending = false;
+        emit(ButtonGesture::DoublePress, atMs);
+    }
+    else
+    {
+        clickPending = true;
+        releasedAt = atMs;
+    }
+}
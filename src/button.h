@@ -0,0 +1,75 @@
+// button.h
+// Debounced gesture recognizer for one push button. It is fed the raw level
+// with a millisecond timestamp on every sample and reports gestures as
+// events; it never reads a pin or waits, so recorded edge sequences can be
+// replayed through it on a host.
+//
+//   Press        released within BUTTON_HOLD_MS, and no second press
+//                followed within BUTTON_DOUBLE_GAP_MS
+//   DoublePress  two such presses, the second starting within the gap
+//   HoldStart    down for BUTTON_HOLD_MS; heldMs() then reports progress
+//   LongHold     still down after the long-hold time (setLongHoldMs())
+//   HoldEnd      released after a HoldStart; heldMs is the full duration
+#pragma once
+
+#include <stdint.h>
+#include "spsc_queue.h"
+
+// A level must be stable this long to count; contact bounce is shorter.
+static const uint32_t BUTTON_DEBOUNCE_MS = 30;
+static const uint32_t BUTTON_HOLD_MS = 1000;
+static const uint32_t BUTTON_DOUBLE_GAP_MS = 300;
+// How often the BOOT button task samples GPIO0 (see system.h).
+static const uint32_t BUTTON_POLL_MS = 10;
+
+enum class ButtonGesture : uint8_t
+{
+    Press,
+    DoublePress,
+    HoldStart,
+    LongHold,
+    HoldEnd,
+};
+
+struct ButtonEvent
+{
+    ButtonGesture gesture;
+    uint32_t atMs;   // when the gesture was recognized
+    uint32_t heldMs; // LongHold and HoldEnd: how long the button was down
+};
+
+class ButtonGestures
+{
+public:
+    explicit ButtonGestures(uint32_t longHoldMs) : longHoldMs(longHoldMs) {}
+
+    // Feed the current raw level (true = pressed) at nowMs. Call at least
+    // every BUTTON_POLL_MS-ish; timestamps must not go backwards.
+    void update(bool down, uint32_t nowMs);
+    bool poll(ButtonEvent &out) { return events.pop(out); }
+
+    // Takes effect for the current hold too, unless LongHold already fired.
+    void setLongHoldMs(uint32_t ms) { longHoldMs = ms; }
+    uint32_t longHold() const { return longHoldMs; }
+    // Debounced hold in progress (after HoldStart), and for how long.
+    bool holding() const { return isHolding; }
+    uint32_t heldMs(uint32_t nowMs) const { return isHolding ? nowMs - downAt : 0; }
+    // Events lost because poll() was not called often enough.
+    uint32_t dropped() const { return events.dropped(); }
+
+private:
+    void pressed(uint32_t atMs);
+    void released(uint32_t atMs);
+    void emit(ButtonGesture g, uint32_t atMs, uint32_t heldMs = 0);
+
+    uint32_t longHoldMs;
+    bool raw = false;
+    uint32_t rawSince = 0;
+    bool stable = false;
+    uint32_t downAt = 0;
+    bool isHolding = false;
+    bool longFired = false;
+    bool clickPending = false; // a Press that may still become a DoublePress
+    uint32_t releasedAt = 0;
+    SpscQueue<ButtonEvent, 8> events;
+};
@@ -1,12 +1,810 @@
 #include "config.h"
+#include "config_schema.h"
+#include "json_writer.h"
+#include "metrics.h"
 #include <LittleFS.h>
-#include <ArduinoJson.h>
+#include <Preferences.h>
 
-// Use the library's JsonDocument symbol explicitly to avoid conflicts or
-// deprecation ambiguity between DynamicJsonDocument/StaticJsonDocument.
+// All paths below are driven by CONFIG_FIELDS (config_schema.h): a small
+// flat-object JSON reader/writer working on stack buffers replaces the
+// per-call JsonDocument and String allocations.
 
 const char *CONFIG_PATH = "/config.json";
 
+// Packed binary mirror of Config kept in the "thermabridge" Preferences
+// namespace so boot can skip mounting LittleFS and parsing JSON. config.json
+// stays the source of truth: the image is rewritten by every save/JSON load
+// and records the CRC of the JSON bytes it mirrors.
+static const char *PREFS_NAMESPACE = "thermabridge";
+static const char *CONFIG_CACHE_KEY = "cfg_bin";
+static const uint32_t CONFIG_CACHE_MAGIC = 0x54424346; // "TBCF"
+
+struct ConfigImage
+{
+    uint32_t magic;
+    uint32_t schema;  // CONFIG_SCHEMA_HASH; any Config/table change invalidates
+    uint32_t jsonCrc; // CRC32 of the /config.json bytes this image mirrors
+    Config cfg;
+    uint32_t crc; // CRC32 of every byte above
+};
+
+// Current snapshot plus the lock guarding the pointer swap. The snapshot
+// itself is immutable once published, so only the shared_ptr copy needs the
+// critical section.
+static std::shared_ptr<const ConfigSnapshot> currentSnapshot;
+static uint32_t currentGeneration = 0;
+static portMUX_TYPE snapshotMux = portMUX_INITIALIZER_UNLOCKED;
+
+// ---- field access ----
+
+static uint8_t *fieldPtr(Config &cfg, const ConfigField &f)
+{
+    return reinterpret_cast<uint8_t *>(&cfg) + f.offset;
+}
+
+static const uint8_t *fieldPtr(const Config &cfg, const ConfigField &f)
+{
+    return reinterpret_cast<const uint8_t *>(&cfg) + f.offset;
+}
+
+static const ConfigField *findField(const char *name)
+{
+    for (size_t i = 0; i < CONFIG_FIELD_COUNT; ++i)
+    {
+        if (strcmp(CONFIG_FIELDS[i].name, name) == 0)
+            return &CONFIG_FIELDS[i];
+    }
+    return nullptr;
+}
+
+static int32_t getNum(const Config &cfg, const ConfigField &f)
+{
+    const uint8_t *p = fieldPtr(cfg, f);
+    switch (f.type)
+    {
+    case ConfigType::Bool:
+        return *reinterpret_cast<const bool *>(p) ? 1 : 0;
+    case ConfigType::U8:
+        return *p;
+    case ConfigType::U16:
+        return *reinterpret_cast<const uint16_t *>(p);
+    default:
+        return 0;
+    }
+}
+
+// Caller has range-checked v against the field.
+static void setNum(Config &cfg, const ConfigField &f, int32_t v)
+{
+    uint8_t *p = fieldPtr(cfg, f);
+    switch (f.type)
+    {
+    case ConfigType::Bool:
+        *reinterpret_cast<bool *>(p) = v != 0;
+        break;
+    case ConfigType::U8:
+        *p = (uint8_t)v;
+        break;
+    case ConfigType::U16:
+        *reinterpret_cast<uint16_t *>(p) = (uint16_t)v;
+        break;
+    default:
+        break;
+    }
+}
+
+static void setDefault(Config &cfg, const ConfigField &f)
+{
+    if (f.type == ConfigType::Str)
+        strlcpy(reinterpret_cast<char *>(fieldPtr(cfg, f)), f.defStr, f.size);
+    else
+        setNum(cfg, f, f.defNum);
+}
+
+void configDefaults(Config &cfg)
+{
+    memset(&cfg, 0, sizeof(cfg));
+    for (size_t i = 0; i < CONFIG_FIELD_COUNT; ++i)
+        setDefault(cfg, CONFIG_FIELDS[i]);
+}
+
+// Dotted-quad IPv4 address: four decimal octets 0..255, nothing else.
+static bool isIpv4(const char *s)
+{
+    for (int octet = 0; octet < 4; ++octet)
+    {
+        if (octet && *s++ != '.')
+            return false;
+        int digits = 0;
+        int v = 0;
+        for (; *s >= '0' && *s <= '9'; ++s, ++digits)
+            v = v * 10 + (*s - '0');
+        if (digits == 0 || digits > 3 || v > 255)
+            return false;
+    }
+    return *s == '\0';
+}
+
+// Format check for a string field; empty always passes (min length is
+// checked separately).
+static bool formatOk(const ConfigField &f, const char *s)
+{
+    return f.format != ConfigFormat::Ipv4 || *s == '\0' || isIpv4(s);
+}
+
+// True when every string is NUL-terminated within its buffer and every value
+// is inside its schema range. Guards images read back from NVS.
+static bool configSane(const Config &cfg)
+{
+    for (size_t i = 0; i < CONFIG_FIELD_COUNT; ++i)
+    {
+        const ConfigField &f = CONFIG_FIELDS[i];
+        if (f.type == ConfigType::Str)
+        {
+            const char *s = reinterpret_cast<const char *>(fieldPtr(cfg, f));
+            size_t len = strnlen(s, f.size);
+            if (len == f.size || (int32_t)len < f.min || !formatOk(f, s))
+                return false;
+        }
+        else
+        {
+            int32_t v = getNum(cfg, f);
+            if (v < f.min || v > f.max)
+                return false;
+        }
+    }
+    return true;
+}
+
+// Treat empty (or whitespace-only) SSID as "no config" so the device will
+// enter provisioning mode instead of calling WiFi.begin() with an invalid SSID.
+static bool isBlank(const char *s)
+{
+    for (; *s; ++s)
+    {
+        if (!isWhitespace(*s))
+            return false;
+    }
+    return true;
+}
+
+// Parse a full decimal integer (optional leading '-'); rejects trailing junk.
+static bool parseInt(const char *s, int32_t &out)
+{
+    bool neg = (*s == '-');
+    if (neg)
+        ++s;
+    if (!*s)
+        return false;
+    int64_t v = 0;
+    for (; *s; ++s)
+    {
+        if (*s < '0' || *s > '9')
+            return false;
+        v = v * 10 + (*s - '0');
+        if (v > 0x7FFFFFFF)
+            return false;
+    }
+    out = (int32_t)(neg ? -v : v);
+    return true;
+}
+
+static ConfigFieldStatus setFieldText(Config &cfg, const ConfigField &f, const char *value)
+{
+    if (*value == '\0')
+    {
+        setDefault(cfg, f);
+        return ConfigFieldStatus::Ok;
+    }
+    if (f.type == ConfigType::Str)
+    {
+        size_t len = strlen(value);
+        if ((int32_t)len < f.min || (int32_t)len > f.max)
+            return ConfigFieldStatus::OutOfRange;
+        if (!formatOk(f, value))
+            return ConfigFieldStatus::BadValue;
+        memcpy(fieldPtr(cfg, f), value, len + 1);
+        return ConfigFieldStatus::Ok;
+    }
+    int32_t v;
+    if (f.type == ConfigType::Bool)
+    {
+        if (strcmp(value, "true") == 0 || strcmp(value, "on") == 0 || strcmp(value, "1") == 0)
+            v = 1;
+        else if (strcmp(value, "false") == 0 || strcmp(value, "off") == 0 || strcmp(value, "0") == 0)
+            v = 0;
+        else
+            return ConfigFieldStatus::BadValue;
+    }
+    else if (!parseInt(value, v))
+    {
+        return ConfigFieldStatus::BadValue;
+    }
+    if (v < f.min || v > f.max)
+        return ConfigFieldStatus::OutOfRange;
+    setNum(cfg, f, v);
+    return ConfigFieldStatus::Ok;
+}
+
+ConfigFieldStatus configSetField(Config &cfg, const char *name, const char *value)
+{
+    const ConfigField *f = findField(name);
+    if (!f)
+        return ConfigFieldStatus::UnknownField;
+    return setFieldText(cfg, *f, value);
+}
+
+size_t maskSecret(const char *secret, char *out, size_t outSize)
+{
+    if (outSize == 0)
+        return 0;
+    size_t n = strnlen(secret, outSize - 1);
+    memset(out, '*', n);
+    out[n] = '\0';
+    return n;
+}
+
+// Plain bitwise CRC32 (IEEE); inputs are a few hundred bytes so a table
+// would cost more flash than it saves time.
+static uint32_t crc32(const uint8_t *data, size_t len, uint32_t crc = 0)
+{
+    crc = ~crc;
+    while (len--)
+    {
+        crc ^= *data++;
+        for (int k = 0; k < 8; ++k)
+            crc = (crc >> 1) ^ (0xEDB88320UL & (0UL - (crc & 1)));
+    }
+    return ~crc;
+}
+
+// ---- JSON writer ----
+
+size_t configToJson(const Config &cfg, char *out, size_t outSize, bool maskSecrets)
+{
+    JsonWriter w(out, outSize);
+    w.beginObject();
+    for (size_t i = 0; i < CONFIG_FIELD_COUNT; ++i)
+    {
+        const ConfigField &f = CONFIG_FIELDS[i];
+        w.key(f.name);
+        if (f.type == ConfigType::Str)
+        {
+            const char *s = reinterpret_cast<const char *>(fieldPtr(cfg, f));
+            if (maskSecrets && f.secret)
+            {
+                char masked[sizeof(Config::psk)];
+                maskSecret(s, masked, sizeof(masked));
+                w.str(masked);
+            }
+            else
+            {
+                w.str(s);
+            }
+        }
+        else if (f.type == ConfigType::Bool)
+        {
+            w.boolean(getNum(cfg, f) != 0);
+        }
+        else
+        {
+            w.num((uint32_t)getNum(cfg, f));
+        }
+    }
+    w.endObject();
+    return w.finish();
+}
+
+// ---- JSON reader ----
+
+// Byte source for the flat JSON reader: a memory buffer, or a File read
+// through a small stack window. File reads keep a running CRC of every byte
+// pulled in so a load can record exactly which bytes the NVS image mirrors.
+class JsonSource
+{
+public:
+    JsonSource(const char *data, size_t len) : file(nullptr), p(data), end(data + len), crc(0) {}
+    explicit JsonSource(File &f) : file(&f), p(window), end(window), crc(0) {}
+
+    int peek()
+    {
+        if (p == end && !refill())
+            return -1;
+        return (uint8_t)*p;
+    }
+
+    int next()
+    {
+        int c = peek();
+        if (c >= 0)
+            ++p;
+        return c;
+    }
+
+    // Consume whatever is left and return the CRC of the whole file.
+    uint32_t drainCrc()
+    {
+        p = end;
+        while (refill())
+            p = end;
+        return crc;
+    }
+
+private:
+    bool refill()
+    {
+        if (!file)
+            return false;
+        size_t n = file->read(reinterpret_cast<uint8_t *>(window), sizeof(window));
+        metricsCountFs(MET_FS_READ);
+        if (n == 0)
+            return false;
+        crc = crc32(reinterpret_cast<const uint8_t *>(window), n, crc);
+        p = window;
+        end = window + n;
+        return true;
+    }
+
+    File *file;
+    const char *p;
+    const char *end;
+    char window[64];
+    uint32_t crc;
+};
+
+static void skipWs(JsonSource &src)
+{
+    int c;
+    while ((c = src.peek()) == ' ' || c == '\t' || c == '\n' || c == '\r')
+        src.next();
+}
+
+static bool expect(JsonSource &src, char want)
+{
+    skipWs(src);
+    return src.next() == want;
+}
+
+static bool expectWord(JsonSource &src, const char *word)
+{
+    for (; *word; ++word)
+    {
+        if (src.next() != *word)
+            return false;
+    }
+    return true;
+}
+
+static int hexVal(int c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+// Reads a string literal (opening quote already peeked) into out, decoding
+// escapes to UTF-8. out may be nullptr to skip. Sets `truncated` if the
+// decoded text does not fit outSize - 1 bytes. Returns false on bad syntax.
+static bool readString(JsonSource &src, char *out, size_t outSize, bool &truncated)
+{
+    truncated = false;
+    size_t len = 0;
+    auto emit = [&](uint8_t b)
+    {
+        if (!out)
+            return;
+        if (len + 1 < outSize)
+            out[len++] = (char)b;
+        else
+            truncated = true;
+    };
+    if (src.next() != '"')
+        return false;
+    for (;;)
+    {
+        int c = src.next();
+        if (c < 0 || c < 0x20)
+            return false;
+        if (c == '"')
+            break;
+        if (c != '\\')
+        {
+            emit((uint8_t)c);
+            continue;
+        }
+        c = src.next();
+        switch (c)
+        {
+        case '"':
+        case '\\':
+        case '/':
+            emit((uint8_t)c);
+            break;
+        case 'b':
+            emit('\b');
+            break;
+        case 'f':
+            emit('\f');
+            break;
+        case 'n':
+            emit('\n');
+            break;
+        case 'r':
+            emit('\r');
+            break;
+        case 't':
+            emit('\t');
+            break;
+        case 'u':
+        {
+            uint32_t cp = 0;
+            for (int i = 0; i < 4; ++i)
+            {
+                int h = hexVal(src.next());
+                if (h < 0)
+                    return false;
+                cp = (cp << 4) | (uint32_t)h;
+            }
+            // Surrogate pairs are not expected in config values; decode
+            // lone surrogates as '?' rather than emitting invalid UTF-8.
+            if (cp >= 0xD800 && cp <= 0xDFFF)
+                emit('?');
+            else if (cp < 0x80)
+                emit((uint8_t)cp);
+            else if (cp < 0x800)
+            {
+                emit((uint8_t)(0xC0 | (cp >> 6)));
+                emit((uint8_t)(0x80 | (cp & 0x3F)));
+            }
+            else
+            {
+                emit((uint8_t)(0xE0 | (cp >> 12)));
+                emit((uint8_t)(0x80 | ((cp >> 6) & 0x3F)));
+                emit((uint8_t)(0x80 | (cp & 0x3F)));
+            }
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+    if (out && outSize)
+        out[len] = '\0';
+    return true;
+}
+
+// Reads a JSON number. `isInt` is cleared for fractions/exponents or values
+// outside int32 range; the syntax is still consumed.
+static bool readNumber(JsonSource &src, int32_t &out, bool &isInt)
+{
+    isInt = true;
+    bool neg = false;
+    int64_t v = 0;
+    int c = src.peek();
+    if (c == '-')
+    {
+        neg = true;
+        src.next();
+    }
+    int digits = 0;
+    while ((c = src.peek()) >= '0' && c <= '9')
+    {
+        src.next();
+        ++digits;
+        if (v <= 0x7FFFFFFF)
+            v = v * 10 + (c - '0');
+    }
+    if (digits == 0)
+        return false;
+    if (v > 0x7FFFFFFF)
+        isInt = false;
+    while ((c = src.peek()) == '.' || c == 'e' || c == 'E' || c == '+' || c == '-' || (c >= '0' && c <= '9'))
+    {
+        src.next();
+        isInt = false;
+    }
+    out = (int32_t)(neg ? -v : v);
+    return true;
+}
+
+// Skips any JSON value, including nested objects/arrays, for unknown keys.
+static bool skipValue(JsonSource &src, int depth = 0)
+{
+    if (depth > 8)
+        return false;
+    skipWs(src);
+    int c = src.peek();
+    bool truncated;
+    int32_t n;
+    bool isInt;
+    switch (c)
+    {
+    case '"':
+        return readString(src, nullptr, 0, truncated);
+    case 't':
+        return expectWord(src, "true");
+    case 'f':
+        return expectWord(src, "false");
+    case 'n':
+        return expectWord(src, "null");
+    case '{':
+    case '[':
+    {
+        char close = (c == '{') ? '}' : ']';
+        src.next();
+        skipWs(src);
+        if (src.peek() == close)
+        {
+            src.next();
+            return true;
+        }
+        for (;;)
+        {
+            if (c == '{')
+            {
+                skipWs(src);
+                if (!readString(src, nullptr, 0, truncated) || !expect(src, ':'))
+                    return false;
+            }
+            if (!skipValue(src, depth + 1))
+                return false;
+            skipWs(src);
+            int d = src.next();
+            if (d == close)
+                return true;
+            if (d != ',')
+                return false;
+        }
+    }
+    default:
+        return readNumber(src, n, isInt);
+    }
+}
+
+// Reads one value for field f into cfg. Returns false on a syntax error.
+// A well-formed value of the wrong type or outside the range sets `bad` and
+// leaves the field untouched; `null` restores the schema default.
+static bool readFieldValue(JsonSource &src, Config &cfg, const ConfigField &f, bool &bad)
+{
+    bad = false;
+    skipWs(src);
+    int c = src.peek();
+    if (c == 'n')
+    {
+        if (!expectWord(src, "null"))
+            return false;
+        setDefault(cfg, f);
+        return true;
+    }
+    if (f.type == ConfigType::Str)
+    {
+        if (c != '"')
+        {
+            bad = true;
+            return skipValue(src);
+        }
+        char tmp[sizeof(Config::psk)]; // largest string field
+        static_assert(sizeof(Config::psk) >= sizeof(Config::ota_password) && sizeof(Config::psk) >= sizeof(Config::ssid) &&
+                          sizeof(Config::psk) >= sizeof(Config::devname),
+                      "tmp must fit the largest string field");
+        bool truncated;
+        if (!readString(src, tmp, f.size, truncated))
+            return false;
+        if (truncated || (int32_t)strlen(tmp) < f.min || !formatOk(f, tmp))
+            bad = true;
+        else
+            memcpy(fieldPtr(cfg, f), tmp, strlen(tmp) + 1);
+        return true;
+    }
+    int32_t v;
+    if (f.type == ConfigType::Bool)
+    {
+        if (c == 't')
+        {
+            if (!expectWord(src, "true"))
+                return false;
+            v = 1;
+        }
+        else if (c == 'f')
+        {
+            if (!expectWord(src, "false"))
+                return false;
+            v = 0;
+        }
+        else
+        {
+            bad = true;
+            return skipValue(src);
+        }
+    }
+    else
+    {
+        if (c != '-' && (c < '0' || c > '9'))
+        {
+            bad = true;
+            return skipValue(src);
+        }
+        bool isInt;
+        if (!readNumber(src, v, isInt))
+            return false;
+        if (!isInt)
+        {
+            bad = true;
+            return true;
+        }
+    }
+    if (v < f.min || v > f.max)
+        bad = true;
+    else
+        setNum(cfg, f, v);
+    return true;
+}
+
+// Applies a flat JSON object onto cfg, field by field. Unknown keys are
+// skipped. In strict mode the first bad value aborts with its name in
+// *badField; otherwise bad values are ignored (the field keeps its value).
+static bool readConfigJson(JsonSource &src, Config &cfg, bool strict, const char **badField)
+{
+    if (!expect(src, '{'))
+        return false;
+    skipWs(src);
+    if (src.peek() == '}')
+    {
+        src.next();
+        return true;
+    }
+    for (;;)
+    {
+        char key[32];
+        bool truncated;
+        skipWs(src);
+        if (!readString(src, key, sizeof(key), truncated) || !expect(src, ':'))
+            return false;
+        const ConfigField *f = truncated ? nullptr : findField(key);
+        if (f)
+        {
+            bool bad;
+            if (!readFieldValue(src, cfg, *f, bad))
+                return false;
+            if (bad && strict)
+            {
+                if (badField)
+                    *badField = f->name;
+                return false;
+            }
+        }
+        else if (!skipValue(src))
+        {
+            return false;
+        }
+        skipWs(src);
+        int c = src.next();
+        if (c == '}')
+            return true;
+        if (c != ',')
+            return false;
+    }
+}
+
+bool configMergePatch(Config &cfg, const char *json, size_t len, const char **badField)
+{
+    if (badField)
+        *badField = nullptr;
+    Config next = cfg;
+    JsonSource src(json, len);
+    if (!readConfigJson(src, next, true, badField))
+        return false;
+    // Nothing but whitespace may follow the object.
+    skipWs(src);
+    if (src.peek() >= 0)
+        return false;
+    cfg = next;
+    return true;
+}
+
+uint8_t configDiff(const Config &a, const Config &b)
+{
+    uint8_t impact = CFG_IMPACT_NONE;
+    for (size_t i = 0; i < CONFIG_FIELD_COUNT; ++i)
+    {
+        const ConfigField &f = CONFIG_FIELDS[i];
+        bool differs = (f.type == ConfigType::Str)
+                           ? strcmp(reinterpret_cast<const char *>(fieldPtr(a, f)), reinterpret_cast<const char *>(fieldPtr(b, f))) != 0
+                           : getNum(a, f) != getNum(b, f);
+        if (differs)
+            impact |= f.impact;
+    }
+    return impact;
+}
+
+// ---- NVS image ----
+
+// Write the packed image for cfg.
+static void writeConfigCache(const Config &cfg, uint32_t jsonCrc)
+{
+    ConfigImage img;
+    memset(&img, 0, sizeof(img));
+    img.magic = CONFIG_CACHE_MAGIC;
+    img.schema = CONFIG_SCHEMA_HASH;
+    img.jsonCrc = jsonCrc;
+    memcpy(&img.cfg, &cfg, sizeof(Config));
+    img.crc = crc32(reinterpret_cast<const uint8_t *>(&img), offsetof(ConfigImage, crc));
+
+    Preferences p;
+    if (!p.begin(PREFS_NAMESPACE, false))
+        return;
+    p.putBytes(CONFIG_CACHE_KEY, &img, sizeof(img));
+    p.end();
+}
+
+// Read and validate the packed image. Returns false on a missing image or any
+// magic/schema/size/CRC mismatch, or out-of-range contents.
+static bool readConfigCache(ConfigImage &img)
+{
+    Preferences p;
+    if (!p.begin(PREFS_NAMESPACE, true))
+        return false;
+    size_t n = p.getBytes(CONFIG_CACHE_KEY, &img, sizeof(img));
+    p.end();
+    if (n != sizeof(img))
+        return false;
+    if (img.magic != CONFIG_CACHE_MAGIC || img.schema != CONFIG_SCHEMA_HASH)
+        return false;
+    if (img.crc != crc32(reinterpret_cast<const uint8_t *>(&img), offsetof(ConfigImage, crc)))
+        return false;
+    return configSane(img.cfg);
+}
+
+// ---- snapshot ----
+
+// Publish a new snapshot; bumpGeneration is true only for saves and erases so
+// the generation tracks what is persisted, not how often it was read.
+static void publishSnapshot(const Config &cfg, bool valid, bool bumpGeneration)
+{
+    ConfigSnapshot *snap = new ConfigSnapshot();
+    snap->cfg = cfg;
+    snap->valid = valid;
+    std::shared_ptr<const ConfigSnapshot> next(snap);
+    portENTER_CRITICAL(&snapshotMux);
+    if (bumpGeneration)
+        ++currentGeneration;
+    snap->generation = currentGeneration;
+    currentSnapshot.swap(next);
+    portEXIT_CRITICAL(&snapshotMux);
+    // `next` now holds the previous snapshot and is released outside the lock.
+}
+
+std::shared_ptr<const ConfigSnapshot> configSnapshot()
+{
+    portENTER_CRITICAL(&snapshotMux);
+    std::shared_ptr<const ConfigSnapshot> snap = currentSnapshot;
+    portEXIT_CRITICAL(&snapshotMux);
+    if (!snap)
+    {
+        // Nothing loaded yet: hand out an invalid snapshot of defaults.
+        ConfigSnapshot *empty = new ConfigSnapshot();
+        configDefaults(empty->cfg);
+        empty->valid = false;
+        empty->generation = 0;
+        snap.reset(empty);
+    }
+    return snap;
+}
+
+uint32_t configGeneration()
+{
+    portENTER_CRITICAL(&snapshotMux);
+    uint32_t gen = currentGeneration;
+    portEXIT_CRITICAL(&snapshotMux);
+    return gen;
+}
+
+// ---- load / save ----
+
 bool loadConfig(Config &cfg)
 {
     if (!LittleFS.begin())
@@ -14,90 +812,118 @@ bool loadConfig(Config &cfg)
     if (!LittleFS.exists(CONFIG_PATH))
         return false;
     File f = LittleFS.open(CONFIG_PATH, "r");
+    metricsCountFs(MET_FS_OPEN);
     if (!f)
         return false;
-    ArduinoJson::JsonDocument doc;
-    DeserializationError err = deserializeJson(doc, f);
+    configDefaults(cfg);
+    JsonSource src(f);
+    bool ok = readConfigJson(src, cfg, false, nullptr);
+    // The CRC must cover the whole file, including anything after the object.
+    uint32_t jsonCrc = src.drainCrc();
     f.close();
-    if (err)
-        return false;
-    cfg.ssid = doc["ssid"] | "";
-    cfg.psk = doc["psk"] | "";
-    cfg.devname = doc["devname"] | "ThermaBridge";
-    cfg.reset_hold_seconds = doc["reset_hold_seconds"] | 10;
-    cfg.ota_password = doc["ota_password"] | "";
-    cfg.mdns_enable = doc["mdns_enable"] | true;
-    cfg.display_enabled = doc["display_enabled"] | true;
-    cfg.display_width = doc["display_width"] | 128;
-    cfg.display_height = doc["display_height"] | 64;
-    cfg.display_sda_pin = doc["display_sda_pin"] | 21;
-    cfg.display_scl_pin = doc["display_scl_pin"] | 4;
-    cfg.encoder_enabled = doc["encoder_enabled"] | true;
-    cfg.encoder_clk_pin = doc["encoder_clk_pin"] | 16;
-    cfg.encoder_dt_pin = doc["encoder_dt_pin"] | 17;
-    cfg.encoder_sw_pin = doc["encoder_sw_pin"] | 18;
-    cfg.climate_enabled = doc["climate_enabled"] | true;
-    // Treat empty (or whitespace-only) SSID as "no config" so
-    // the device will enter provisioning mode instead of
-    // attempting to call WiFi.begin() with an invalid SSID.
-    auto is_blank = [](const String &s)
-    {
-        for (size_t i = 0; i < s.length(); ++i)
-        {
-            if (!isWhitespace(s[i]))
-                return false;
-        }
-        return true;
-    };
+    if (!ok)
+        return false;
 
-    if (cfg.ssid.length() == 0 || is_blank(cfg.ssid))
-    {
+    bool valid = !isBlank(cfg.ssid);
+    // Re-prime the fast path so the next boot skips this parse.
+    if (valid)
+        writeConfigCache(cfg, jsonCrc);
+    publishSnapshot(cfg, valid, false);
+    return valid;
+}
+
+bool loadConfigCached(Config &cfg)
+{
+    ConfigImage img;
+    if (!readConfigCache(img))
+        return false;
+    // Only valid configs are ever cached, but a blank SSID must still mean
+    // "no config" regardless of where it came from.
+    if (isBlank(img.cfg.ssid))
         return false;
+    memcpy(&cfg, &img.cfg, sizeof(Config));
+    publishSnapshot(cfg, true, false);
+    return true;
+}
+
+ConfigCacheState configCacheState()
+{
+    ConfigImage img;
+    if (!readConfigCache(img))
+        return ConfigCacheState::Current; // nothing cached, nothing can be stale
+    if (!LittleFS.begin())
+        return ConfigCacheState::Current;
+    if (!LittleFS.exists(CONFIG_PATH))
+        return ConfigCacheState::FileMissing;
+    File f = LittleFS.open(CONFIG_PATH, "r");
+    metricsCountFs(MET_FS_OPEN);
+    if (!f)
+        return ConfigCacheState::Current;
+    uint8_t buf[128];
+    uint32_t crc = 0;
+    size_t n;
+    while ((n = f.read(buf, sizeof(buf))) > 0)
+    {
+        metricsCountFs(MET_FS_READ);
+        crc = crc32(buf, n, crc);
     }
+    f.close();
+    return crc == img.jsonCrc ? ConfigCacheState::Current : ConfigCacheState::Stale;
+}
 
-    return true;
+void invalidateConfigCache()
+{
+    Preferences p;
+    if (!p.begin(PREFS_NAMESPACE, false))
+        return;
+    p.remove(CONFIG_CACHE_KEY);
+    p.end();
 }
 
 bool saveConfig(const Config &cfg)
 {
     if (!LittleFS.begin())
         return false;
+    // Serialize once into a stack buffer so the NVS image can record the CRC
+    // of the exact bytes written to flash.
+    char body[CONFIG_JSON_MAX];
+    size_t len = configToJson(cfg, body, sizeof(body), false);
+    if (len == 0)
+        return false;
     File f = LittleFS.open(CONFIG_PATH, "w");
+    metricsCountFs(MET_FS_OPEN);
     if (!f)
         return false;
-    ArduinoJson::JsonDocument doc;
-    doc["ssid"] = cfg.ssid;
-    doc["psk"] = cfg.psk;
-    doc["devname"] = cfg.devname;
-    doc["reset_hold_seconds"] = cfg.reset_hold_seconds;
-    doc["ota_password"] = cfg.ota_password;
-    doc["mdns_enable"] = cfg.mdns_enable;
-    doc["display_enabled"] = cfg.display_enabled;
-    doc["display_width"] = cfg.display_width;
-    doc["display_height"] = cfg.display_height;
-    doc["display_sda_pin"] = cfg.display_sda_pin;
-    doc["display_scl_pin"] = cfg.display_scl_pin;
-    doc["encoder_enabled"] = cfg.encoder_enabled;
-    doc["encoder_clk_pin"] = cfg.encoder_clk_pin;
-    doc["encoder_dt_pin"] = cfg.encoder_dt_pin;
-    doc["encoder_sw_pin"] = cfg.encoder_sw_pin;
-    doc["climate_enabled"] = cfg.climate_enabled;
-    if (serializeJson(doc, f) == 0)
-    {
-        f.close();
+    size_t written = f.write(reinterpret_cast<const uint8_t *>(body), len);
+    metricsCountFs(MET_FS_WRITE);
+    f.close();
+    if (written != len)
+    {
+        invalidateConfigCache();
         return false;
     }
-    f.close();
+    bool valid = !isBlank(cfg.ssid);
+    if (valid)
+        writeConfigCache(cfg, crc32(reinterpret_cast<const uint8_t *>(body), len));
+    else
+        invalidateConfigCache();
+    publishSnapshot(cfg, valid, true);
     return true;
 }
 
 bool eraseConfig()
 {
+    invalidateConfigCache();
     if (!LittleFS.begin())
         return false;
     if (LittleFS.exists(CONFIG_PATH))
     {
-        return LittleFS.remove(CONFIG_PATH);
+        metricsCountFs(MET_FS_REMOVE);
+        if (!LittleFS.remove(CONFIG_PATH))
+            return false;
     }
+    Config defaults;
+    configDefaults(defaults);
+    publishSnapshot(defaults, false, true);
     return true;
 }
@@ -1,14 +1,20 @@
 #ifndef CONFIG_H
 #define CONFIG_H
 #include <Arduino.h>
+#include <memory>
 
+// Device configuration. Every field is described by one row of the schema
+// table in config_schema.h, which drives defaults, range checks, JSON
+// load/save and secret masking; adding a field means adding a member here and
+// a row there. Strings are fixed, NUL-terminated buffers so the struct is
+// trivially copyable and never touches the heap.
 struct Config
 {
-    String ssid;
-    String psk;
-    String devname;
+    char ssid[33]; // up to 32 bytes + NUL
+    char psk[65];  // up to 64 chars (hex PSK) + NUL
+    char devname[33];
     uint16_t reset_hold_seconds; // seconds to hold BOOT button to factory reset
-    String ota_password;         // optional password for ArduinoOTA
+    char ota_password[65];       // optional password for ArduinoOTA
     bool mdns_enable;
     bool display_enabled;    // enable OLED display
     uint16_t display_width;  // display width in pixels
@@ -19,11 +25,106 @@ struct Config
     uint8_t encoder_clk_pin; // CLK pin for encoder
     uint8_t encoder_dt_pin;  // DT pin for encoder
     uint8_t encoder_sw_pin;  // SW pin for encoder
+    bool encoder_accel;      // fast turns step 2/4/8 menu entries (see quadrature.h)
     bool climate_enabled;    // enable climate sensors (AHT20 + BMP280)
+    uint8_t log_level;       // runtime log level, 0 (off) .. 4 (debug); see logger.h
+
+    // Wi-Fi connection, read at boot (see fast_connect.h). Empty IP fields
+    // mean DHCP.
+    uint8_t wifi_fast_connect; // 0 off, 1 reuse last AP + channel, 2 also the DHCP lease
+    char static_ip[16];
+    char static_gateway[16]; // required with static_ip
+    char static_subnet[16];  // empty = 255.255.255.0
+    char static_dns[16];     // empty = the gateway
+    uint16_t ap_fallback_minutes; // outage before the provisioning AP opens; 0 = never (see wifi_link.h)
+};
+
+// Immutable copy of the active configuration, owned by config.cpp.
+// A new snapshot is published by loadConfig() (boot), saveConfig() and
+// eraseConfig(); readers never touch the filesystem.
+struct ConfigSnapshot
+{
+    Config cfg;
+    bool valid;          // true when cfg holds a usable config (non-blank SSID)
+    uint32_t generation; // bumped only by saveConfig()/eraseConfig()
 };
 
+// What has to be re-initialized when a field changes; each schema row
+// carries a mask of these. CFG_IMPACT_NONE fields are read live.
+enum ConfigImpact : uint8_t
+{
+    CFG_IMPACT_NONE = 0,
+    CFG_IMPACT_REBOOT = 1 << 0, // Wi-Fi credentials and IP settings: only a reboot applies them
+    CFG_IMPACT_DISPLAY = 1 << 1,
+    CFG_IMPACT_ENCODER = 1 << 2,
+    CFG_IMPACT_MDNS = 1 << 3,
+    CFG_IMPACT_OTA = 1 << 4,
+    CFG_IMPACT_CLIMATE = 1 << 5,
+};
+
+// Outcome of setting one field from text (see configSetField()).
+enum class ConfigFieldStatus : uint8_t
+{
+    Ok,
+    UnknownField, // no schema row with that name
+    BadValue,     // not parseable as the field's type
+    OutOfRange,   // parsed, but outside the schema range/length
+};
+
+// Parse /config.json into cfg and refresh the NVS fast-path image. Fields
+// that are missing, mistyped or out of range take their schema default.
+// Returns false when the file is missing/unparsable or the SSID is blank.
 bool loadConfig(Config &cfg);
+// Write cfg to /config.json and mirror it into the NVS image.
 bool saveConfig(const Config &cfg);
+// Remove /config.json and the NVS image.
 bool eraseConfig();
 
+// Boot fast path: load cfg from the packed, CRC-checked image saveConfig()
+// keeps in the "thermabridge" Preferences namespace. No LittleFS access.
+// Returns false on a missing image or version/CRC mismatch; callers then fall
+// back to loadConfig().
+bool loadConfigCached(Config &cfg);
+enum class ConfigCacheState : uint8_t
+{
+    Current,     // the image mirrors /config.json byte-for-byte, or no image
+    Stale,       // /config.json was replaced behind our back, e.g. by `uploadfs`
+    FileMissing, // no /config.json, e.g. LittleFS was just formatted
+};
+// Compare the NVS image with /config.json. Mounts LittleFS. A file that
+// exists but cannot be read counts as Current: only a CRC mismatch is Stale.
+ConfigCacheState configCacheState();
+// Drop the NVS image so the next boot parses /config.json.
+void invalidateConfigCache();
+
+// Returns the current snapshot. Never null; before any load it holds schema
+// defaults, is invalid and has generation 0. Holding the pointer keeps that
+// snapshot alive even if a save publishes a newer one meanwhile.
+std::shared_ptr<const ConfigSnapshot> configSnapshot();
+// Generation of the current snapshot; cheaper than configSnapshot() for
+// "has anything been saved since?" polling.
+uint32_t configGeneration();
+
+// Fill every field with its schema default.
+void configDefaults(Config &cfg);
+// Set the field called `name` from its textual form (as posted by a form):
+// decimal for numbers, true/false/1/0/on/off for booleans, raw for strings.
+// An empty value restores the field default. cfg is untouched on error.
+ConfigFieldStatus configSetField(Config &cfg, const char *name, const char *value);
+// Apply a JSON merge patch (RFC 7396) to cfg. The patch must be a flat
+// object: present keys replace values, `null` restores the schema default,
+// unknown keys are ignored. All-or-nothing: on a syntax error or a bad value
+// cfg is untouched and false is returned, with the offending field name in
+// *badField when it was a value problem.
+bool configMergePatch(Config &cfg, const char *json, size_t len, const char **badField);
+// ConfigImpact bits of every field that differs between a and b.
+uint8_t configDiff(const Config &a, const Config &b);
+// Serialize cfg as a flat JSON object into out (NUL-terminated). Secret
+// fields are replaced by '*' runs when maskSecrets is set. Returns the length
+// written, or 0 if out is too small (CONFIG_JSON_MAX always suffices).
+size_t configToJson(const Config &cfg, char *out, size_t outSize, bool maskSecrets);
+// Copy secret as a same-length run of '*' into out (NUL-terminated, truncated
+// to outSize - 1). Returns the length written.
+size_t maskSecret(const char *secret, char *out, size_t outSize);
+
 #endif // CONFIG_H
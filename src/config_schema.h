@@ -0,0 +1,181 @@
+// config_schema.h
+// Compile-time description of struct Config. One row per field drives
+// defaults, parsing, range checks, JSON (de)serialization and masking in
+// config.cpp. Adding a field: add the member to Config and one row below.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+
+enum class ConfigType : uint8_t
+{
+    Str,
+    Bool,
+    U8,
+    U16,
+};
+
+// Extra syntax check for string fields, on top of the length range.
+enum class ConfigFormat : uint8_t
+{
+    Any,
+    Ipv4, // dotted quad, or empty for "unset"
+};
+
+// Maps a Config member type to its ConfigType so rows cannot disagree with
+// the struct; an unsupported member type fails to compile.
+template <typename T>
+struct ConfigTypeOf;
+template <>
+struct ConfigTypeOf<bool>
+{
+    static constexpr ConfigType value = ConfigType::Bool;
+};
+template <>
+struct ConfigTypeOf<uint8_t>
+{
+    static constexpr ConfigType value = ConfigType::U8;
+};
+template <>
+struct ConfigTypeOf<uint16_t>
+{
+    static constexpr ConfigType value = ConfigType::U16;
+};
+template <size_t N>
+struct ConfigTypeOf<char[N]>
+{
+    static constexpr ConfigType value = ConfigType::Str;
+};
+
+struct ConfigField
+{
+    const char *name;   // JSON key and form argument name
+    ConfigType type;    // storage type of the member
+    uint16_t offset;    // offsetof(Config, member)
+    uint16_t size;      // sizeof(member); for strings the capacity incl. NUL
+    const char *defStr; // default for strings (nullptr otherwise)
+    int32_t defNum;     // default for numbers and booleans
+    int32_t min;        // inclusive lower bound (strings: minimum length)
+    int32_t max;        // inclusive upper bound (strings: maximum length)
+    bool secret;        // never returned or displayed in clear text
+    uint8_t impact;     // ConfigImpact bits: what must re-init when it changes
+    ConfigFormat format; // strings only
+};
+
+#define CFG_MEMBER_SIZE(m) sizeof(((Config *)nullptr)->m)
+#define CFG_STR_FMT(m, def, minLen, secret, impact, format)                                      \
+    {                                                                                            \
+        #m, ConfigTypeOf<decltype(Config::m)>::value, offsetof(Config, m),                       \
+            CFG_MEMBER_SIZE(m), def, 0, minLen, CFG_MEMBER_SIZE(m) - 1, secret, impact, format \
+    }
+#define CFG_STR(m, def, minLen, secret, impact) CFG_STR_FMT(m, def, minLen, secret, impact, ConfigFormat::Any)
+#define CFG_IPV4(m, impact) CFG_STR_FMT(m, "", 0, false, impact, ConfigFormat::Ipv4)
+#define CFG_NUM(m, def, lo, hi, impact)                                                 \
+    {                                                                                   \
+        #m, ConfigTypeOf<decltype(Config::m)>::value, offsetof(Config, m),              \
+            CFG_MEMBER_SIZE(m), nullptr, def, lo, hi, false, impact, ConfigFormat::Any \
+    }
+#define CFG_BOOL(m, def, impact) CFG_NUM(m, def, 0, 1, impact)
+
+// ESP32-S3 GPIOs run 0..48.
+static const int32_t CFG_GPIO_MAX = 48;
+
+// Row order is the key order of the serialized config.json.
+static constexpr ConfigField CONFIG_FIELDS[] = {
+    CFG_STR(ssid, "", 0, false, CFG_IMPACT_REBOOT),
+    CFG_STR(psk, "", 0, true, CFG_IMPACT_REBOOT),
+    CFG_STR(devname, "ThermaBridge", 1, false, CFG_IMPACT_MDNS | CFG_IMPACT_OTA | CFG_IMPACT_DISPLAY),
+    CFG_NUM(reset_hold_seconds, 10, 1, 300, CFG_IMPACT_NONE), // read live by buttonTask()
+    CFG_STR(ota_password, "", 0, true, CFG_IMPACT_OTA),
+    CFG_BOOL(mdns_enable, true, CFG_IMPACT_MDNS),
+    CFG_BOOL(display_enabled, true, CFG_IMPACT_DISPLAY),
+    CFG_NUM(display_width, 128, 8, 128, CFG_IMPACT_DISPLAY),
+    CFG_NUM(display_height, 64, 8, 64, CFG_IMPACT_DISPLAY),
+    CFG_NUM(display_sda_pin, 21, 0, CFG_GPIO_MAX, CFG_IMPACT_DISPLAY | CFG_IMPACT_CLIMATE), // shared I2C bus
+    CFG_NUM(display_scl_pin, 4, 0, CFG_GPIO_MAX, CFG_IMPACT_DISPLAY | CFG_IMPACT_CLIMATE),
+    CFG_BOOL(encoder_enabled, true, CFG_IMPACT_ENCODER),
+    CFG_NUM(encoder_clk_pin, 16, 0, CFG_GPIO_MAX, CFG_IMPACT_ENCODER),
+    CFG_NUM(encoder_dt_pin, 17, 0, CFG_GPIO_MAX, CFG_IMPACT_ENCODER),
+    CFG_NUM(encoder_sw_pin, 18, 0, CFG_GPIO_MAX, CFG_IMPACT_ENCODER),
+    CFG_BOOL(encoder_accel, false, CFG_IMPACT_ENCODER),
+    CFG_BOOL(climate_enabled, true, CFG_IMPACT_CLIMATE),
+    CFG_NUM(log_level, 3, 0, 4, CFG_IMPACT_NONE), // applied by applyNetConfigChanges()
+    CFG_NUM(wifi_fast_connect, 1, 0, 2, CFG_IMPACT_NONE), // read at the next boot; see fast_connect.h
+    CFG_IPV4(static_ip, CFG_IMPACT_REBOOT),
+    CFG_IPV4(static_gateway, CFG_IMPACT_REBOOT),
+    CFG_IPV4(static_subnet, CFG_IMPACT_REBOOT),
+    CFG_IPV4(static_dns, CFG_IMPACT_REBOOT),
+    CFG_NUM(ap_fallback_minutes, 10, 0, 1440, CFG_IMPACT_NONE), // read live by wifiLinkLoop()
+};
+
+static constexpr size_t CONFIG_FIELD_COUNT = sizeof(CONFIG_FIELDS) / sizeof(CONFIG_FIELDS[0]);
+
+// ---- compile-time checks and sizes (C++11 constexpr, hence recursion) ----
+
+constexpr size_t cfgStrLen(const char *s)
+{
+    return *s ? 1 + cfgStrLen(s + 1) : 0;
+}
+
+constexpr int32_t cfgTypeMax(ConfigType t)
+{
+    return t == ConfigType::Bool ? 1 : t == ConfigType::U8 ? 0xFF : t == ConfigType::U16 ? 0xFFFF : 0;
+}
+
+constexpr bool cfgFieldValid(const ConfigField &f)
+{
+    return f.type == ConfigType::Str
+               ? (f.defStr != nullptr && f.min >= 0 && f.max == (int32_t)f.size - 1 &&
+                  (int32_t)cfgStrLen(f.defStr) >= f.min && (int32_t)cfgStrLen(f.defStr) <= f.max)
+               : (f.defStr == nullptr && f.format == ConfigFormat::Any && f.min >= 0 && f.min <= f.max && f.max <= cfgTypeMax(f.type) &&
+                  f.defNum >= f.min && f.defNum <= f.max);
+}
+
+constexpr bool cfgFieldsValid(size_t i)
+{
+    return i == CONFIG_FIELD_COUNT || (cfgFieldValid(CONFIG_FIELDS[i]) && cfgFieldsValid(i + 1));
+}
+
+static_assert(cfgFieldsValid(0), "config schema: a default is outside its range or a range exceeds its type");
+
+// Worst-case serialized length of one value: strings may escape every byte
+// as \u00XX.
+constexpr size_t cfgValueMax(const ConfigField &f)
+{
+    return f.type == ConfigType::Str ? 2 + 6 * (size_t)f.max : f.type == ConfigType::Bool ? 5 : f.type == ConfigType::U8 ? 3 : 5;
+}
+
+constexpr size_t cfgJsonMax(size_t i)
+{
+    // "name": value,
+    return i == CONFIG_FIELD_COUNT ? 0 : cfgStrLen(CONFIG_FIELDS[i].name) + 4 + cfgValueMax(CONFIG_FIELDS[i]) + cfgJsonMax(i + 1);
+}
+
+// Buffer size (incl. braces and NUL) that always fits configToJson() output.
+static constexpr size_t CONFIG_JSON_MAX = cfgJsonMax(0) + 3;
+
+// FNV-1a over each row's name, type, offset and size. Stored in the NVS
+// image so any change to Config or the table invalidates old images.
+constexpr uint32_t cfgFnv(const char *s, uint32_t h)
+{
+    return *s ? cfgFnv(s + 1, (h ^ (uint8_t)*s) * 16777619UL) : h;
+}
+
+constexpr uint32_t cfgFnvWord(uint32_t v, uint32_t h)
+{
+    return (((((((h ^ (v & 0xFF)) * 16777619UL) ^ ((v >> 8) & 0xFF)) * 16777619UL) ^ ((v >> 16) & 0xFF)) * 16777619UL) ^
+            (v >> 24)) *
+           16777619UL;
+}
+
+constexpr uint32_t cfgSchemaHash(size_t i, uint32_t h)
+{
+    return i == CONFIG_FIELD_COUNT
+               ? cfgFnvWord(sizeof(Config), h)
+               : cfgSchemaHash(i + 1, cfgFnvWord(((uint32_t)CONFIG_FIELDS[i].type << 24) ^
+                                                     ((uint32_t)CONFIG_FIELDS[i].offset << 8) ^ CONFIG_FIELDS[i].size,
+                                                 cfgFnv(CONFIG_FIELDS[i].name, h)));
+}
+
+static constexpr uint32_t CONFIG_SCHEMA_HASH = cfgSchemaHash(0, 2166136261UL);
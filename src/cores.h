@@ -0,0 +1,18 @@
+// cores.h
+// Which core runs what. Wi-Fi and lwIP already live on core 0, so the
+// network services (status server, provisioning portal, OTA, mDNS, the Wi-Fi
+// link supervisor, telemetry) run there too, from the "net" scheduler task.
+// The Arduino loop task on core 1 owns the display, the I2C sensors, the
+// encoder, the BOOT button and the LED, so a slow OLED flush or sensor
+// conversion never delays a request. Data crosses between the two only
+// through SpscQueue (spsc_queue.h), config snapshots or atomics; each side
+// keeps its own copy of the config (cfg / uiCfg in globals.h).
+#pragma once
+
+#include <stdint.h>
+
+static const int NET_CORE = 0;
+static const int UI_CORE = 1; // ARDUINO_RUNNING_CORE, where loop() runs
+// Stack for the net scheduler task: OTA updates, startStatusServer() and
+// the telemetry event buffer all run on it.
+static const uint32_t NET_TASK_STACK = 8192;
@@ -4,30 +4,74 @@
 #include "config.h"
 #include "build_info.h"
 #include "globals.h"
+#include "metrics.h"
+#include "profiler.h"
+#include "sensors.h"
+#include "cores.h"
+#include "ui_state.h"
+#include "widgets.h"
+#include <atomic>
 
-Adafruit_SSD1306 display(128, 64, &Wire, OLED_RESET);
+ShadowSSD1306 display(128, 64, &Wire, OLED_RESET);
 
-const char *menuItems[] = {"Status", "Config", "Climate", "Reboot"};
-const int MENU_ITEMS_COUNT = 4;
-const int MAX_VISIBLE_MENU_ITEMS = 6;
+// True once display.begin() succeeded for the current config; drawing is
+// skipped otherwise (the framebuffer may not even be allocated).
+static bool displayReady = false;
+// Which screen is up and when it needs drawing (ui_state.h); fed and drawn
+// by displayLoop(), restarted by displayInit() so a live reconfiguration
+// redraws from scratch.
+static UiStateMachine ui;
+// Widgets of the screen that is up, redrawn as their data changes.
+static WidgetScreen screen;
+// BOOT hold progress is on screen (displayShowHold()), and what it showed.
+static bool holdScreen = false;
+static uint32_t holdShownKey = 0;
 
-int getOptimalTextSize(String text, int maxWidth)
+// Stack and priority of the OLED flush task (ssd1306_shadow.h). It sits
+// above loop() on the UI core so a finished transfer is picked up at once,
+// and sleeps while I2C is busy.
+static const uint32_t OLED_TASK_STACK = 3072;
+static const unsigned OLED_TASK_PRIORITY = 2;
+
+// Runs on the flush task (or inline before it started): the only writer of
+// the display I2C and latency histograms.
+static void onFrameFlushed(const ShadowSSD1306::FlushStats &stats, uint32_t latencyUs)
 {
-    int len = text.length();
-    for (int size = 3; size >= 1; size--)
+    if (stats.windows)
     {
-        int charWidth = size * 6; // approximate character width
-        if (len * charWidth <= maxWidth)
-            return size;
+        metricsObserveI2c(MET_I2C_DISPLAY, stats.busUs);
+        metricsObserveDisplayLatency(latencyUs);
     }
-    return 1;
+    metricsCountDisplayFrame(stats.full ? MET_FRAME_FULL : stats.windows ? MET_FRAME_PARTIAL : MET_FRAME_UNCHANGED,
+                             stats.bytes);
+}
+
+// Hand the framebuffer to the flush task and return; only what changed goes
+// over I2C (see ssd1306_shadow.h).
+static void flushDisplay()
+{
+    if (!display.submit())
+        metricsCountDisplayFrame(MET_FRAME_DROPPED, 0);
 }
 
 void displayInit(const Config &cfg)
 {
+    // May be called again on a live config change: blank a panel that is
+    // being disabled and restart the bus in case the pins moved.
+    if (displayReady && !cfg.display_enabled)
+    {
+        display.clearDisplay();
+        flushDisplay();
+    }
+    displayReady = false;
+    holdScreen = false;
+    ui.begin(encoder != nullptr, encoder ? UiScreen::Menu : UiScreen::Status, millis());
     if (!cfg.display_enabled)
         return;
 
+    // Let a frame in flight finish before the bus is restarted.
+    display.waitIdle(200);
+    Wire.end();
     Wire.begin(cfg.display_sda_pin, cfg.display_scl_pin);
 
     if (!display.begin(SSD1306_SWITCHCAPVCC, 0x3C))
@@ -35,271 +79,382 @@ void displayInit(const Config &cfg)
         Serial.println("SSD1306 allocation failed");
         return;
     }
+    display.setFlushHook(onFrameFlushed);
+    if (!display.startFlushTask(UI_CORE, OLED_TASK_STACK, OLED_TASK_PRIORITY))
+        Serial.println("OLED flush task failed to start; flushing inline");
     display.clearDisplay();
     display.setTextSize(1);
     display.setTextColor(SSD1306_WHITE);
     display.setCursor(0, 0);
-    display.display();
+    flushDisplay();
+    displayReady = true;
     Serial.println("SSD1306 initialized");
 }
 
-void displaySplashScreen(const Config &cfg, bool waitForInput)
+void displaySplash()
 {
-    display.clearDisplay();
+    ui.begin(encoder != nullptr, UiScreen::Splash, millis());
+}
 
-    // Device name
-    int nameSize = getOptimalTextSize(cfg.devname, 128);
-    display.setTextSize(nameSize);
-    int charWidth = nameSize * 6;
-    int textWidth = cfg.devname.length() * charWidth;
-    int x = (128 - textWidth) / 2;
-    display.setCursor(x, 10);
-    display.println(cfg.devname);
-
-    // Version
-    String version = String(FW_BASE_VERSION).substring(1); // remove 'v'
-    String verText = "Ver " + version;
-    display.setTextSize(1); // smaller
-    charWidth = 6;
-    textWidth = verText.length() * charWidth;
-    x = (128 - textWidth) / 2;
-    display.setCursor(x, 40);
-    display.println(verText);
-
-    display.display();
-
-    if (!waitForInput)
-        return;
+void displayResetMenu()
+{
+    ui.begin(encoder != nullptr, encoder ? UiScreen::Menu : UiScreen::Status, millis());
+}
 
-    // Wait for encoder input
-    if (encoder)
-    {
-        encoder->update(); // Update before getting initial position
-        int initialPos = encoder->getPosition();
-        while (true)
-        {
-            encoder->update();
-            if (encoder->getPosition() != initialPos || encoder->isButtonPressed())
-            {
-                if (encoder->isButtonPressed())
-                {
-                    // Wait for button release to avoid immediate select in menu
-                    while (encoder->isButtonPressed())
-                    {
-                        encoder->update();
-                        delay(10);
-                    }
-                }
-                break;
-            }
-            delay(10); // small delay to avoid busy loop
-        }
-    }
-    else
-    {
-        delay(3000); // fallback if no encoder
-    }
+// Bound data for the screens below. Where the value is a number the stamp
+// is the value itself, so it changes exactly when the text may; nullptr
+// stamps are sampled once when the screen is shown.
+
+static void textDevname(uint8_t, char *buf, size_t cap)
+{
+    snprintf(buf, cap, "%s", uiCfg.devname);
+}
+
+static void textVersion(uint8_t, char *buf, size_t cap)
+{
+    snprintf(buf, cap, "Ver %s", FW_BASE_VERSION + 1); // without the 'v'
+}
+
+static const Widget SPLASH_WIDGETS[] = {
+    widgetValue(0, 8, 128, 24, 0, nullptr, textDevname, 0, WidgetAlign::Center),
+    widgetValue(0, 40, 128, 8, 1, nullptr, textVersion, 0, WidgetAlign::Center),
+};
+
+// Only the two lines the cursor leaves and enters change.
+static uint32_t stampMenuLine(uint8_t item)
+{
+    return ui.menuIndex() == item;
+}
+
+static void textMenuLine(uint8_t item, char *buf, size_t cap)
+{
+    snprintf(buf, cap, "%s%s", ui.menuIndex() == item ? "> " : "  ", uiMenuLabel(item));
+}
+
+static const Widget MENU_WIDGETS[] = {
+    widgetValue(0, 0, 128, 16, 2, stampMenuLine, textMenuLine, 0),
+    widgetValue(0, 16, 128, 16, 2, stampMenuLine, textMenuLine, 1),
+    widgetValue(0, 32, 128, 16, 2, stampMenuLine, textMenuLine, 2),
+    widgetValue(0, 48, 128, 16, 2, stampMenuLine, textMenuLine, 3),
+};
+static_assert(sizeof(MENU_WIDGETS) / sizeof(MENU_WIDGETS[0]) == UI_MENU_COUNT, "one line per menu item");
+
+// Bars of the RSSI gauge, from -90 dBm (none) to -40 dBm (full).
+static const int RSSI_STEPS = 10;
+
+static uint32_t stampIp(uint8_t)
+{
+    return (uint32_t)WiFi.localIP();
+}
+
+static void textIp(uint8_t, char *buf, size_t cap)
+{
+    snprintf(buf, cap, "IP: %s", WiFi.localIP().toString().c_str());
+}
+
+static uint32_t stampUptime(uint8_t)
+{
+    return millis() / 1000;
 }
-String formatUptime()
+
+static void textUptime(uint8_t, char *buf, size_t cap)
 {
     unsigned long seconds = millis() / 1000;
     unsigned long minutes = seconds / 60;
     unsigned long hours = minutes / 60;
     unsigned long days = hours / 24;
     if (days > 0)
-    {
-        return String(days) + "d " + String(hours % 24) + "h " + String(minutes % 60) + "m";
-    }
+        snprintf(buf, cap, "Uptime: %lud %luh %lum", days, hours % 24, minutes % 60);
     else if (hours > 0)
-    {
-        return String(hours) + "h " + String(minutes % 60) + "m";
-    }
+        snprintf(buf, cap, "Uptime: %luh %lum", hours, minutes % 60);
     else
+        snprintf(buf, cap, "Uptime: %lum %lus", minutes, seconds % 60);
+}
+
+static uint8_t levelWifiUp(uint8_t)
+{
+    return WiFi.status() == WL_CONNECTED;
+}
+
+static uint32_t stampWifiUp(uint8_t arg)
+{
+    return levelWifiUp(arg);
+}
+
+static uint8_t levelRssi(uint8_t)
+{
+    if (WiFi.status() != WL_CONNECTED)
+        return 0;
+    int step = (WiFi.RSSI() + 90) * RSSI_STEPS / 50;
+    step = step < 0 ? 0 : step > RSSI_STEPS ? RSSI_STEPS : step;
+    return (uint8_t)(step * 255 / RSSI_STEPS);
+}
+
+static uint32_t stampRssi(uint8_t arg)
+{
+    return levelRssi(arg);
+}
+
+static const uint8_t WIFI_ICON[] = {
+    0b01111110, 0b10000001, 0b00111100, 0b01000010, 0b00011000, 0b00100100, 0b00000000, 0b00011000,
+};
+
+static const Widget STATUS_WIDGETS[] = {
+    widgetValue(0, 0, 116, 8, 1, stampIp, textIp),
+    widgetIcon(120, 0, 8, 8, WIFI_ICON, stampWifiUp, levelWifiUp),
+    widgetValue(0, 8, 128, 8, 1, stampUptime, textUptime),
+    widgetLabel(0, 20, 30, 8, 1, "RSSI"),
+    widgetBar(30, 19, 98, 10, stampRssi, levelRssi),
+};
+
+static void textConfig(uint8_t line, char *buf, size_t cap)
+{
+    switch (line)
+    {
+    case 0:
+        snprintf(buf, cap, "SSID: %s", uiCfg.ssid);
+        break;
+    case 1:
     {
-        return String(minutes) + "m " + String(seconds % 60) + "s";
+        char masked[sizeof(uiCfg.psk)];
+        maskSecret(uiCfg.psk, masked, sizeof(masked));
+        snprintf(buf, cap, "PSK: %s", masked);
+        break;
+    }
+    default:
+        snprintf(buf, cap, "Dev: %s", uiCfg.devname);
+        break;
     }
 }
 
-void displayStatus(const Config &cfg)
+// Two rows each: a long SSID or PSK wraps.
+static const Widget CONFIG_WIDGETS[] = {
+    widgetValue(0, 0, 128, 16, 1, nullptr, textConfig, 0),
+    widgetValue(0, 16, 128, 16, 1, nullptr, textConfig, 1),
+    widgetValue(0, 32, 128, 16, 1, nullptr, textConfig, 2),
+};
+
+// Reading on the climate screen; taken when it is entered and every
+// UI_CLIMATE_REFRESH_MS, since a read blocks for the conversion.
+static ClimateReading climate;
+static bool climateOk = false;
+static uint32_t climateSamples = 0;
+
+static void sampleClimate()
 {
-    display.clearDisplay();
-    display.setTextSize(1);
-    display.setCursor(0, 0);
-    display.printf("IP: %s\n", WiFi.localIP().toString().c_str());
-    display.printf("Uptime: %s\n", formatUptime().c_str());
-    display.display();
+    climateOk = sensorsRead(climate);
+    climateSamples++;
 }
 
-void displayConfig()
+static uint32_t stampClimate(uint8_t)
 {
-    display.clearDisplay();
-    display.setTextSize(1);
-    display.setCursor(0, 0);
-    display.printf("SSID: %s\n", cfg.ssid.c_str());
-    String masked = "";
-    for (size_t i = 0; i < cfg.psk.length(); ++i)
-        masked += '*';
-    display.printf("PSK: %s\n", masked.c_str());
-    display.printf("Dev: %s\n", cfg.devname.c_str());
-    display.display();
+    return climateSamples;
 }
 
-void displayClimate()
+static void textClimate(uint8_t line, char *buf, size_t cap)
 {
-    display.clearDisplay();
-    display.setTextSize(1);
-    display.setCursor(0, 0);
-    if (aht20)
+    buf[0] = '\0';
+    if (!climateOk)
+        return;
+    bool havePressure = !isnan(climate.pressureHpa);
+    switch (line)
     {
-        sensors_event_t humidity, temp;
-        aht20->getEvent(&humidity, &temp);
-        if (!isnan(temp.temperature))
-        {
-            display.printf("Temp: %.1f F\n", (temp.temperature * 9.0 / 5.0) + 32.0);
-        }
+    case 0:
+        if (!isnan(climate.tempF))
+            snprintf(buf, cap, "Temp: %.1f F", climate.tempF);
         else
-        {
-            display.println("Temp: -- F");
-        }
-        if (!isnan(humidity.relative_humidity))
-        {
-            display.printf("Hum: %.1f %%\n", humidity.relative_humidity);
-        }
+            snprintf(buf, cap, "Temp: -- F");
+        break;
+    case 1:
+        if (!isnan(climate.humidity))
+            snprintf(buf, cap, "Hum: %.1f %%", climate.humidity);
         else
-        {
-            display.println("Hum: -- %");
-        }
-    }
-    if (bmp280)
-    {
-        float pres = bmp280->readPressure() / 100.0F;
-        if (!isnan(pres))
-        {
-            display.printf("Pres: %.1f hPa\n", pres);
-        }
+            snprintf(buf, cap, "Hum: -- %%");
+        break;
+    case 2:
+        if (havePressure)
+            snprintf(buf, cap, "Pres: %.1f hPa", climate.pressureHpa);
         else
+            snprintf(buf, cap, "Pres: -- hPa");
+        break;
+    default:
+        if (havePressure)
         {
-            display.println("Pres: -- hPa");
-        }
-        float alt = bmp280->readAltitude(1013.25F); // sea level pressure
-        if (!isnan(alt))
-        {
-            display.printf("Alt: %.1f ft\n", alt * 3.28084F);
+            // Barometric altitude against standard sea-level pressure, as
+            // Adafruit_BMP280::readAltitude(1013.25) computes it.
+            float alt = 44330.0F * (1.0F - powf(climate.pressureHpa / 1013.25F, 0.1903F));
+            snprintf(buf, cap, "Alt: %.1f ft", alt * 3.28084F);
         }
         else
         {
-            display.println("Alt: -- ft");
+            snprintf(buf, cap, "Alt: -- ft");
         }
+        break;
     }
-    display.display();
 }
 
-void displayMenu()
+static const Widget CLIMATE_WIDGETS[] = {
+    widgetValue(0, 0, 128, 8, 1, stampClimate, textClimate, 0),
+    widgetValue(0, 8, 128, 8, 1, stampClimate, textClimate, 1),
+    widgetValue(0, 16, 128, 8, 1, stampClimate, textClimate, 2),
+    widgetValue(0, 24, 128, 8, 1, stampClimate, textClimate, 3),
+};
+
+// Device name only, moved to a new spot every UI_SAVER_STEP_MS so no pixel
+// stays lit. Drawn directly: it changes as a whole.
+static void drawScreensaver(const Config &cfg, uint32_t step)
 {
     display.clearDisplay();
-    display.setTextSize(2);
-    display.setCursor(0, 0);
-
-    int start = 0;
-    if (MENU_ITEMS_COUNT > MAX_VISIBLE_MENU_ITEMS)
-    {
-        start = menuIndex - MAX_VISIBLE_MENU_ITEMS / 2;
-        if (start < 0)
-            start = 0;
-        if (start + MAX_VISIBLE_MENU_ITEMS > MENU_ITEMS_COUNT)
-            start = MENU_ITEMS_COUNT - MAX_VISIBLE_MENU_ITEMS;
-    }
+    display.setTextSize(1);
+    int w = min((int)strlen(cfg.devname) * 6, 128);
+    int xSpan = 128 - w + 1;
+    int ySpan = 64 - 8 + 1;
+    display.setCursor((int)((step * 37) % (uint32_t)xSpan), (int)((step * 23) % (uint32_t)ySpan));
+    display.print(cfg.devname);
+    flushDisplay();
+}
 
-    for (int i = start; i < min(start + MAX_VISIBLE_MENU_ITEMS, MENU_ITEMS_COUNT); i++)
-    {
-        if (i == menuIndex)
-            display.print("> ");
-        else
-            display.print("  ");
-        display.println(menuItems[i]);
-    }
-    display.display();
+template <size_t N> static void showWidgets(const Widget (&table)[N])
+{
+    screen.show(table, (uint8_t)N);
 }
 
-void handleMenuSelect()
+// Bind the widgets of the screen that is up; the next screen.update()
+// draws all of them.
+static void composeScreen()
 {
-    switch (menuIndex)
+    switch (ui.screen())
     {
-    case 0:
-        displayStatus(cfg);
+    case UiScreen::Splash:
+        showWidgets(SPLASH_WIDGETS);
         break;
-    case 1:
-        displayConfig();
+    case UiScreen::Menu:
+        showWidgets(MENU_WIDGETS);
         break;
-    case 2:
-        displayClimate();
+    case UiScreen::Status:
+        showWidgets(STATUS_WIDGETS);
         break;
-    case 3:
-        ESP.restart();
+    case UiScreen::Config:
+        showWidgets(CONFIG_WIDGETS);
+        break;
+    case UiScreen::Climate:
+        sampleClimate();
+        showWidgets(CLIMATE_WIDGETS);
+        break;
+    case UiScreen::Screensaver:
+        screen.show(nullptr, 0);
+        drawScreensaver(uiCfg, ui.saverStep());
         break;
     }
 }
 
-void displayLoop()
+void displayOnButton(ButtonGesture gesture)
 {
-    if (!encoder)
-    {
-        // No encoder, just status
-        static unsigned long lastUpdate = 0;
-        if (millis() - lastUpdate > 5000)
-        {
-            displayStatus(cfg);
-            lastUpdate = millis();
-        }
+    if (!displayReady || holdScreen)
         return;
-    }
+    ui.button(gesture, millis()); // displayLoop() draws the result
+}
 
-    encoder->update(); // Update encoder state
+void displayShowHold(uint32_t heldMs, uint32_t apMs, uint32_t resetMs)
+{
+    if (!displayReady || resetMs == 0)
+        return;
+    const int BAR_W = 124;
+    uint32_t secs = heldMs / 1000;
+    int fill = heldMs >= resetMs ? BAR_W : (int)((uint64_t)heldMs * BAR_W / resetMs);
+    bool apArmed = heldMs >= apMs;
+    uint32_t key = (secs << 8) | ((uint32_t)fill << 1) | (apArmed ? 1 : 0);
+    ui.activity(millis()); // no screensaver behind the progress screen
+    if (holdScreen && key == holdShownKey)
+        return;
+    holdScreen = true;
+    holdShownKey = key;
 
-    // Check for idle
-    if (millis() - lastEncoderActivity > 30000)
-    {
-        displaySplashScreen(cfg, false);
-        // Wait for encoder input to dismiss
-        encoder->update();
-        int initialPos = encoder->getPosition();
-        while (true)
-        {
-            encoder->update();
-            if (encoder->getPosition() != initialPos || encoder->isButtonPressed())
-            {
-                lastEncoderActivity = millis();
-                break;
-            }
-            delay(10);
-        }
-    }
+    display.clearDisplay();
+    display.setTextSize(1);
+    display.setCursor(0, 0);
+    display.printf("BOOT held %lu s\n\n", (unsigned long)secs);
+    display.println(apArmed ? "Release: Wi-Fi AP" : "Release: cancel");
+    uint32_t left = heldMs >= resetMs ? 0 : (resetMs - heldMs + 999) / 1000;
+    display.printf("Reset in %lu s\n", (unsigned long)left);
+    display.drawRect(0, 48, BAR_W + 4, 12, SSD1306_WHITE);
+    // Tick where releasing starts to request the AP.
+    if (apMs < resetMs)
+        display.drawFastVLine(2 + (int)((uint64_t)apMs * BAR_W / resetMs), 46, 16, SSD1306_WHITE);
+    display.fillRect(2, 50, fill, 8, SSD1306_WHITE);
+    flushDisplay();
+}
 
-    // With encoder, menu mode
-    static int lastPos = 0;
-    static bool initialized = false;
-    if (!initialized)
+void displayEndHold()
+{
+    if (!holdScreen)
+        return;
+    holdScreen = false;
+    ui.invalidate(); // displayLoop() puts the screen back
+}
+
+#ifdef TB_UI_STRESS
+// millis() deadline of a displayStress() run; 0 when none is active.
+static std::atomic<uint32_t> stressUntil{0};
+
+void displayStress(uint32_t ms)
+{
+    stressUntil.store(ms ? (uint32_t)millis() + ms : 0, std::memory_order_relaxed);
+}
+
+// Move the menu cursor on every call while a stress run is active, so each
+// pass redraws two menu lines and flushes them.
+static void stressTick(uint32_t now)
+{
+    uint32_t until = stressUntil.load(std::memory_order_relaxed);
+    if (!until)
+        return;
+    if ((int32_t)(until - now) <= 0)
     {
-        lastPos = encoder->getPosition();
-        lastEncoderActivity = millis();
-        initialized = true;
-        displayMenu(); // Show initial menu
+        stressUntil.store(0, std::memory_order_relaxed);
+        return;
     }
+    ui.turn(1, now);
+}
+#endif
 
-    int pos = encoder->getPosition();
-    if (pos != lastPos)
+void displayLoop()
+{
+    if (!displayReady)
+        return;
+
+    // Everything the encoder ISR queued since the last pass, in order;
+    // nothing is lost when a pass comes late.
+    uint32_t now = millis();
+    UiAction action = UiAction::None;
+    EncoderEvent ev;
+    while (encoder && encoder->poll(ev))
     {
-        menuIndex = (menuIndex + (pos - lastPos)) % MENU_ITEMS_COUNT;
-        if (menuIndex < 0)
-            menuIndex += MENU_ITEMS_COUNT;
-        lastPos = pos;
-        lastEncoderActivity = millis();
-        displayMenu();
+        if (holdScreen)
+            continue; // BOOT hold progress owns the screen; input is dropped
+        if (ev.type == EncoderEventType::Rotate)
+            ui.turn(ev.delta, now);
+        else if (ui.select(now) == UiAction::Reboot)
+            action = UiAction::Reboot;
     }
+    if (holdScreen)
+        return;
+    if (action == UiAction::Reboot)
+        ESP.restart();
+#ifdef TB_UI_STRESS
+    stressTick(now);
+#endif
 
-    if (encoder->isButtonPressed())
+    ui.tick(now);
+    if (ui.takeRedraw())
+        composeScreen();
+    else if (ui.takeSample())
+        sampleClimate();
+    uint8_t drawn;
     {
-        lastEncoderActivity = millis();
-        handleMenuSelect();
+        PROFILE_SCOPE("ui", "widgets");
+        drawn = screen.update(display);
     }
-}
\ No newline at end of file
+    if (drawn)
+        flushDisplay(); // nothing visible changed otherwise: no frame at all
+}
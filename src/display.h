@@ -4,18 +4,36 @@
 #include <Adafruit_SSD1306.h>
 #include <Adafruit_GFX.h>
 #include "config.h"
+#include "ssd1306_shadow.h"
+#include "button.h"
 
 // OLED display settings
 #define OLED_RESET -1 // No reset pin
-extern Adafruit_SSD1306 display;
+extern ShadowSSD1306 display; // flushed through flush(), never display()
 
 void displayInit(const Config &cfg);
-void displaySplashScreen(const Config &cfg, bool waitForInput = true);
-void displayStatus(const Config &cfg);
-void displayConfig();
-void displayClimate();
-void displayMenu();
-void displayStatus(const Config &cfg);
+// Show the boot splash. displayLoop() keeps it until the encoder is touched
+// (or for UI_SPLASH_MS without an encoder); nothing here waits.
+void displaySplash();
+// Feed encoder input and timers to the screen state machine (ui_state.h) and
+// draw the current screen when it changed. Never blocks.
 void displayLoop();
+#ifdef TB_UI_STRESS
+// Any core: redraw and flush the display continuously for ms (0 stops), to
+// show that network latency does not depend on UI load (see
+// scripts/stress_ui_latency.py).
+void displayStress(uint32_t ms);
+#endif
+// Redraw the menu from scratch, e.g. after the encoder was recreated.
+void displayResetMenu();
+// BOOT button: Press returns to the menu (or refreshes the status screen
+// without an encoder), DoublePress shows the status screen. Other gestures
+// are ignored. Drawn by the next displayLoop().
+void displayOnButton(ButtonGesture gesture);
+// Show BOOT hold progress towards the AP request (apMs) and factory reset
+// (resetMs) thresholds; redraws only when the text or bar changes. While it
+// is up displayLoop() leaves the screen alone, until displayEndHold().
+void displayShowHold(uint32_t heldMs, uint32_t apMs, uint32_t resetMs);
+void displayEndHold();
 
 #endif // DISPLAY_H
\ No newline at end of file
@@ -1,55 +1,58 @@
 #include "encoder.h"
 
-RotaryEncoder::RotaryEncoder(uint8_t clkPin, uint8_t dtPin, uint8_t swPin)
-    : clkPin(clkPin), dtPin(dtPin), swPin(swPin), position(0), lastClkState(HIGH), buttonPressed(false), lastButtonState(HIGH) {}
+RotaryEncoder::RotaryEncoder(uint8_t clkPin, uint8_t dtPin, uint8_t swPin, bool acceleration)
+    : clkPin(clkPin), dtPin(dtPin), swPin(swPin), attached(false), position(0)
+{
+    decoder.setAcceleration(acceleration);
+}
+
+RotaryEncoder::~RotaryEncoder()
+{
+    if (!attached)
+        return;
+    detachInterrupt(clkPin);
+    detachInterrupt(dtPin);
+    detachInterrupt(swPin);
+}
 
 void RotaryEncoder::begin()
 {
     pinMode(clkPin, INPUT_PULLUP);
     pinMode(dtPin, INPUT_PULLUP);
     pinMode(swPin, INPUT_PULLUP);
-    lastClkState = digitalRead(clkPin);
-    lastButtonState = digitalRead(swPin);
+    attachInterruptArg(clkPin, isr, this, CHANGE);
+    attachInterruptArg(dtPin, isr, this, CHANGE);
+    attachInterruptArg(swPin, isr, this, CHANGE);
+    attached = true;
 }
 
-void RotaryEncoder::update()
+// Shared by all three pins: re-reading every level is cheaper than telling
+// the sources apart, and the decoders ignore inputs that did not change.
+// Not IRAM_ATTR: arduino-esp32 installs the GPIO ISR service without
+// ESP_INTR_FLAG_IRAM (CONFIG_ARDUINO_ISR_IRAM is off), so the dispatcher,
+// digitalRead() and the decoder all run from flash and the interrupt is held
+// off while flash is busy. Edges lost then are what the full-step table is
+// for: a skipped state aborts the detent instead of miscounting it.
+void RotaryEncoder::isr(void *arg)
 {
-    bool clkState = digitalRead(clkPin);
-    bool dtState = digitalRead(dtPin);
-    bool buttonState = digitalRead(swPin);
-
-    // Detect rotation on rising edge of CLK
-    if (clkState != lastClkState && clkState == HIGH)
-    {
-        if (dtState == LOW)
-        {
-            position++;
-        }
-        else
-        {
-            position--;
-        }
-    }
-    lastClkState = clkState;
+    RotaryEncoder *self = static_cast<RotaryEncoder *>(arg);
+    uint32_t now = micros();
+    EncoderEvent ev;
+    if (self->decoder.pins(digitalRead(self->clkPin) == HIGH, digitalRead(self->dtPin) == HIGH, now, ev))
+        self->events.push(ev);
+    if (self->decoder.sw(digitalRead(self->swPin) == LOW, now, ev))
+        self->events.push(ev);
+}
 
-    // Detect button press (falling edge)
-    if (buttonState == LOW && lastButtonState == HIGH)
-    {
-        buttonPressed = true;
-    }
-    else
-    {
-        buttonPressed = false;
-    }
-    lastButtonState = buttonState;
+bool RotaryEncoder::poll(EncoderEvent &ev)
+{
+    if (!events.pop(ev))
+        return false;
+    position += ev.delta;
+    return true;
 }
 
 int RotaryEncoder::getPosition()
 {
     return position;
 }
-
-bool RotaryEncoder::isButtonPressed()
-{
-    return buttonPressed;
-}
\ No newline at end of file
@@ -2,25 +2,37 @@
 #define ENCODER_H
 
 #include <Arduino.h>
+#include "quadrature.h"
+#include "spsc_queue.h"
 
 // KY-040 Rotary Encoder handling
-// CLK and DT pins for rotation, SW for button
+// CLK and DT pins for rotation, SW for button. A pin-change interrupt on all
+// three decodes every edge (quadrature.h), so steps and presses are not lost
+// when the UI is slow; the events wait in a lock-free queue for poll().
+// Create, poll and delete on the UI core.
 
 class RotaryEncoder
 {
 public:
-    RotaryEncoder(uint8_t clkPin, uint8_t dtPin, uint8_t swPin);
+    RotaryEncoder(uint8_t clkPin, uint8_t dtPin, uint8_t swPin, bool acceleration = false);
+    ~RotaryEncoder();
     void begin();
-    void update();          // Call in loop to poll
-    int getPosition();      // Get current position (increments/decrements)
-    bool isButtonPressed(); // Check if button was pressed (edge detect)
+    // Next rotation or press, oldest first. Returns false when there is none.
+    bool poll(EncoderEvent &ev);
+    int getPosition(); // Sum of all rotation deltas handed out by poll()
+    // Events dropped because the queue was full (poll() fell behind).
+    uint32_t dropped() const { return events.dropped(); }
 
 private:
+    static void isr(void *arg);
+
     uint8_t clkPin, dtPin, swPin;
-    volatile int position;
-    bool lastClkState;
-    bool buttonPressed;
-    bool lastButtonState;
+    bool attached;
+    int position;
+    QuadratureDecoder decoder;
+    // Producer: the GPIO ISR (one handler at a time services all pins);
+    // consumer: poll().
+    SpscQueue<EncoderEvent, 32> events;
 };
 
-#endif // ENCODER_H
\ No newline at end of file
+#endif // ENCODER_H
@@ -0,0 +1,115 @@
+#include "fast_connect.h"
+#include <WiFi.h>
+#include <Preferences.h>
+
+static const char *PREFS_NAMESPACE = "thermabridge";
+static const char *FAST_CONNECT_KEY = "wifi_fast";
+static const uint32_t FAST_CONNECT_MAGIC = 0x54424643; // "TBFC"
+
+struct FastConnectRecord
+{
+    uint32_t magic;
+    uint32_t ssidHash; // a record for another network is ignored
+    FastConnectInfo info;
+    uint32_t check; // FNV-1a of every byte above
+};
+
+static uint32_t fnv1a(const void *data, size_t len, uint32_t h = 2166136261UL)
+{
+    const uint8_t *p = static_cast<const uint8_t *>(data);
+    while (len--)
+        h = (h ^ *p++) * 16777619UL;
+    return h;
+}
+
+static bool readRecord(FastConnectRecord &rec)
+{
+    Preferences p;
+    if (!p.begin(PREFS_NAMESPACE, true))
+        return false;
+    size_t n = p.getBytes(FAST_CONNECT_KEY, &rec, sizeof(rec));
+    p.end();
+    return n == sizeof(rec) && rec.magic == FAST_CONNECT_MAGIC &&
+           rec.check == fnv1a(&rec, offsetof(FastConnectRecord, check));
+}
+
+bool loadFastConnect(const Config &cfg, FastConnectInfo &info)
+{
+    FastConnectRecord rec;
+    if (!readRecord(rec) || rec.ssidHash != fnv1a(cfg.ssid, strlen(cfg.ssid)))
+        return false;
+    if (rec.info.channel < 1 || rec.info.channel > 14)
+        return false;
+    info = rec.info;
+    return true;
+}
+
+void saveFastConnect(const Config &cfg)
+{
+    FastConnectRecord rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.magic = FAST_CONNECT_MAGIC;
+    rec.ssidHash = fnv1a(cfg.ssid, strlen(cfg.ssid));
+    const uint8_t *bssid = WiFi.BSSID();
+    if (!bssid)
+        return;
+    memcpy(rec.info.bssid, bssid, sizeof(rec.info.bssid));
+    rec.info.channel = (uint8_t)WiFi.channel();
+    rec.info.hasLease = !hasStaticIp(cfg);
+    if (rec.info.hasLease)
+    {
+        rec.info.ip = WiFi.localIP();
+        rec.info.gateway = WiFi.gatewayIP();
+        rec.info.subnet = WiFi.subnetMask();
+        rec.info.dns = WiFi.dnsIP();
+    }
+    rec.check = fnv1a(&rec, offsetof(FastConnectRecord, check));
+
+    FastConnectRecord old;
+    if (readRecord(old) && memcmp(&old, &rec, sizeof(rec)) == 0)
+        return;
+    Preferences p;
+    if (!p.begin(PREFS_NAMESPACE, false))
+        return;
+    p.putBytes(FAST_CONNECT_KEY, &rec, sizeof(rec));
+    p.end();
+}
+
+void clearFastConnect()
+{
+    Preferences p;
+    if (!p.begin(PREFS_NAMESPACE, false))
+        return;
+    p.remove(FAST_CONNECT_KEY);
+    p.end();
+}
+
+bool hasStaticIp(const Config &cfg)
+{
+    return cfg.static_ip[0] && cfg.static_gateway[0];
+}
+
+void applyIpConfig(const Config &cfg, const FastConnectInfo *lease)
+{
+    if (hasStaticIp(cfg))
+    {
+        IPAddress ip, gateway, subnet(255, 255, 255, 0), dns;
+        ip.fromString(cfg.static_ip);
+        gateway.fromString(cfg.static_gateway);
+        if (cfg.static_subnet[0])
+            subnet.fromString(cfg.static_subnet);
+        dns = gateway;
+        if (cfg.static_dns[0])
+            dns.fromString(cfg.static_dns);
+        WiFi.config(ip, gateway, subnet, dns);
+    }
+    else if (lease && lease->hasLease && lease->ip)
+    {
+        WiFi.config(IPAddress(lease->ip), IPAddress(lease->gateway), IPAddress(lease->subnet), IPAddress(lease->dns));
+    }
+    else
+    {
+        // All zeros re-enables the DHCP client (after a lease that failed).
+        WiFi.config(IPAddress(), IPAddress(), IPAddress());
+    }
+}
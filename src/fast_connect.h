@@ -0,0 +1,40 @@
+// fast_connect.h
+// Boot-time Wi-Fi shortcut. After each successful STA connection the AP's
+// BSSID and channel, plus the DHCP lease, are kept in the "thermabridge"
+// Preferences namespace. The next boot joins that AP directly (no channel
+// scan) and, with wifi_fast_connect = 2, reuses the lease (no DHCP round
+// trip); tryConnectWifi() falls back to a normal scan + DHCP connect when
+// the shortcut does not work.
+//
+// A reused lease is applied like a static address and is not renewed, so
+// mode 2 is meant for networks that reserve the device's address; the
+// default (1) only skips the scan.
+#pragma once
+
+#include <stdint.h>
+#include "config.h"
+
+struct FastConnectInfo
+{
+    uint8_t bssid[6];
+    uint8_t channel;
+    bool hasLease; // false when the connection used a static IP
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns;
+};
+
+// Load the record for cfg's SSID. False when there is none, it belongs to
+// another SSID or it is corrupt.
+bool loadFastConnect(const Config &cfg, FastConnectInfo &info);
+// Record the current STA connection for cfg. The NVS write is skipped when
+// nothing changed, so a normal boot costs no flash wear.
+void saveFastConnect(const Config &cfg);
+void clearFastConnect();
+
+// True when cfg carries a usable static IP (address and gateway).
+bool hasStaticIp(const Config &cfg);
+// Configure the STA interface before WiFi.begin(): cfg's static IP if set,
+// else the cached lease when given, else DHCP.
+void applyIpConfig(const Config &cfg, const FastConnectInfo *lease);
@@ -0,0 +1,54 @@
+#include "file_range.h"
+#include <string.h>
+
+// Parse an unsigned decimal at *p, advancing it. False if there is none or it
+// overflows.
+static bool parseSize(const char *&p, size_t &out)
+{
+    if (*p < '0' || *p > '9')
+        return false;
+    size_t v = 0;
+    for (; *p >= '0' && *p <= '9'; ++p)
+    {
+        size_t next = v * 10 + (size_t)(*p - '0');
+        if (next / 10 != v)
+            return false;
+        v = next;
+    }
+    out = v;
+    return true;
+}
+
+RangeResult parseRange(const char *header, size_t size, size_t &start, size_t &len)
+{
+    if (!header || strncmp(header, "bytes=", 6) != 0 || strchr(header, ','))
+        return RangeResult::Full;
+    const char *p = header + 6;
+    size_t first = 0;
+    size_t last = 0;
+    if (*p == '-')
+    {
+        // Suffix range: the last N bytes.
+        ++p;
+        if (!parseSize(p, last) || *p)
+            return RangeResult::Full;
+        if (last == 0 || size == 0)
+            return RangeResult::Unsatisfiable;
+        len = last < size ? last : size;
+        start = size - len;
+        return RangeResult::Partial;
+    }
+    if (!parseSize(p, first) || *p++ != '-')
+        return RangeResult::Full;
+    if (*p == '\0')
+        last = size ? size - 1 : 0;
+    else if (!parseSize(p, last) || *p || last < first)
+        return RangeResult::Full;
+    if (first >= size)
+        return RangeResult::Unsatisfiable;
+    if (last >= size)
+        last = size - 1;
+    start = first;
+    len = last - first + 1;
+    return RangeResult::Partial;
+}
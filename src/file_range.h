@@ -0,0 +1,18 @@
+// file_range.h
+// `Range: bytes=` header parsing for file_stream.h, kept free of Arduino and
+// LittleFS so it can be tested on a host.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum class RangeResult : uint8_t
+{
+    Full,          // no (usable) Range header: send everything
+    Partial,       // send [start, start + len)
+    Unsatisfiable, // 416
+};
+
+// Parse a Range header value against a file of `size` bytes. header may be
+// null or empty. On Partial, start/len describe the slice.
+RangeResult parseRange(const char *header, size_t size, size_t &start, size_t &len);
@@ -0,0 +1,171 @@
+#include "file_stream.h"
+#include "metrics.h"
+#include <Arduino.h>
+#include <LittleFS.h>
+
+// An opened file plus the slice of it to send.
+struct FilePlan
+{
+    File f;
+    RangeResult range;
+    size_t size;
+    size_t start;
+    size_t len;
+};
+
+// Open path, resolve the Range header and seek to the slice. On failure sets
+// errCode (404/500) and returns false.
+static bool planFile(const char *path, const char *rangeHeader, FilePlan &plan, int &errCode)
+{
+    if (!LittleFS.exists(path))
+    {
+        errCode = 404;
+        return false;
+    }
+    plan.f = LittleFS.open(path, "r");
+    metricsCountFs(MET_FS_OPEN);
+    if (!plan.f)
+    {
+        errCode = 500;
+        return false;
+    }
+    plan.size = plan.f.size();
+    plan.start = 0;
+    plan.len = plan.size;
+    plan.range = parseRange(rangeHeader, plan.size, plan.start, plan.len);
+    if (plan.range == RangeResult::Partial && plan.start && !plan.f.seek(plan.start))
+    {
+        plan.f.close();
+        errCode = 500;
+        return false;
+    }
+    return true;
+}
+
+// ---- AP-mode WebServer ----
+
+void sendFile(WebServer &srv, const char *path, const char *contentType)
+{
+    String range = srv.header("Range");
+    FilePlan plan;
+    int errCode = 0;
+    if (!planFile(path, range.length() ? range.c_str() : nullptr, plan, errCode))
+    {
+        srv.send(errCode, "text/plain", errCode == 404 ? "not found" : "failed to open file");
+        return;
+    }
+
+    char contentRange[48];
+    srv.sendHeader("Accept-Ranges", "bytes");
+    if (plan.range == RangeResult::Unsatisfiable)
+    {
+        snprintf(contentRange, sizeof(contentRange), "bytes */%u", (unsigned)plan.size);
+        srv.sendHeader("Content-Range", contentRange);
+        srv.send(416, "text/plain", "");
+        plan.f.close();
+        return;
+    }
+    int code = 200;
+    if (plan.range == RangeResult::Partial)
+    {
+        snprintf(contentRange, sizeof(contentRange), "bytes %u-%u/%u", (unsigned)plan.start,
+                 (unsigned)(plan.start + plan.len - 1), (unsigned)plan.size);
+        srv.sendHeader("Content-Range", contentRange);
+        code = 206;
+    }
+    srv.setContentLength(plan.len);
+    srv.send(code, contentType, "");
+    if (srv.method() == HTTP_HEAD)
+    {
+        plan.f.close();
+        return;
+    }
+
+    char buf[FILE_STREAM_BLOCK];
+    size_t left = plan.len;
+    while (left > 0)
+    {
+        size_t n = plan.f.read((uint8_t *)buf, left < sizeof(buf) ? left : sizeof(buf));
+        metricsCountFs(MET_FS_READ);
+        if (n == 0)
+            break; // short file; the client sees a truncated body
+        srv.sendContent(buf, n);
+        left -= n;
+    }
+    plan.f.close();
+}
+
+// ---- STA-mode esp_http_server ----
+
+static esp_err_t sendError(httpd_req_t *req, int code)
+{
+    httpd_resp_set_status(req, code == 404 ? "404 Not Found" : "500 Internal Server Error");
+    httpd_resp_set_type(req, "text/plain");
+    return httpd_resp_sendstr(req, code == 404 ? "not found" : "failed to open file");
+}
+
+esp_err_t sendFile(httpd_req_t *req, const char *path, const char *contentType)
+{
+    char range[64];
+    bool hasRange = httpd_req_get_hdr_value_str(req, "Range", range, sizeof(range)) == ESP_OK;
+    FilePlan plan;
+    int errCode = 0;
+    if (!planFile(path, hasRange ? range : nullptr, plan, errCode))
+        return sendError(req, errCode);
+
+    const char *status = "200 OK";
+    char contentRange[48] = "";
+    if (plan.range == RangeResult::Unsatisfiable)
+    {
+        status = "416 Range Not Satisfiable";
+        snprintf(contentRange, sizeof(contentRange), "bytes */%u", (unsigned)plan.size);
+        plan.len = 0;
+    }
+    else if (plan.range == RangeResult::Partial)
+    {
+        status = "206 Partial Content";
+        snprintf(contentRange, sizeof(contentRange), "bytes %u-%u/%u", (unsigned)plan.start,
+                 (unsigned)(plan.start + plan.len - 1), (unsigned)plan.size);
+    }
+
+    if (req->method == HTTP_HEAD)
+    {
+        // httpd_resp_send() would report Content-Length: 0, so write the head
+        // ourselves with the length a GET would get.
+        char head[256];
+        int n = snprintf(head, sizeof(head), "HTTP/1.1 %s\r\nContent-Type: %s\r\nContent-Length: %u\r\nAccept-Ranges: bytes\r\n%s%s%s\r\n",
+                         status, contentType, (unsigned)plan.len, contentRange[0] ? "Content-Range: " : "",
+                         contentRange, contentRange[0] ? "\r\n" : "");
+        plan.f.close();
+        return httpd_send(req, head, n) == n ? ESP_OK : ESP_FAIL;
+    }
+
+    httpd_resp_set_status(req, status);
+    httpd_resp_set_type(req, contentType);
+    httpd_resp_set_hdr(req, "Accept-Ranges", "bytes");
+    if (contentRange[0])
+        httpd_resp_set_hdr(req, "Content-Range", contentRange);
+    if (plan.range == RangeResult::Unsatisfiable)
+    {
+        plan.f.close();
+        return httpd_resp_send(req, nullptr, 0);
+    }
+
+    char buf[FILE_STREAM_BLOCK];
+    size_t left = plan.len;
+    while (left > 0)
+    {
+        size_t n = plan.f.read((uint8_t *)buf, left < sizeof(buf) ? left : sizeof(buf));
+        metricsCountFs(MET_FS_READ);
+        if (n == 0)
+            break;
+        if (httpd_resp_send_chunk(req, buf, n) != ESP_OK)
+        {
+            plan.f.close();
+            return ESP_FAIL; // client went away; httpd closes the socket
+        }
+        left -= n;
+    }
+    plan.f.close();
+    return httpd_resp_send_chunk(req, nullptr, 0);
+}
@@ -0,0 +1,23 @@
+// file_stream.h
+// Streaming LittleFS file responder for both HTTP servers. Files are read and
+// sent in FILE_STREAM_BLOCK-sized pieces through one stack buffer, so memory
+// use does not grow with the file. Supports HEAD and single-range
+// `Range: bytes=` requests (206 / 416); multi-range requests get the whole
+// file, as RFC 9110 allows.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <WebServer.h>
+#include <esp_http_server.h>
+#include "file_range.h"
+
+static const size_t FILE_STREAM_BLOCK = 2048;
+
+// AP-mode WebServer: answers GET or HEAD for `path`. Needs the "Range" header
+// collected on srv. The body goes out with a Content-Length.
+void sendFile(WebServer &srv, const char *path, const char *contentType);
+
+// STA-mode esp_http_server: GET bodies use chunked transfer encoding, HEAD
+// replies carry the Content-Length a GET would have.
+esp_err_t sendFile(httpd_req_t *req, const char *path, const char *contentType);
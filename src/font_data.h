@@ -0,0 +1,529 @@
+// font_data.h
+// Generated by scripts/gen_fonts.py from DejaVu Sans (Bitstream Vera
+// license, free to embed). Do not edit.
+#pragma once
+
+#include <Arduino.h>
+#include "fonts.h"
+
+// DejaVuSans-Bold.ttf at 15 px per em, 16 px line, baseline at row 12: 1518 bytes of glyphs
+static const uint8_t font_sans_16_bitmap[] PROGMEM = {
+    0xfe, 0xfe, 0xfe, 0x0e, 0x0e, 0x0c, 0x1e, 0x1e, 0x00, 0x00, 0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xb0, 0xb0, 0xf8, 0xbe, 0xb0, 0xf0, 0xfc, 0xbe, 0x30, 0x10, 0x01, 0x09, 0x0f,
+    0x03, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x70, 0x78, 0xfc, 0xcc, 0xfe, 0xcc, 0xcc, 0x88,
+    0x04, 0x0c, 0x0c, 0x0c, 0x3f, 0x0c, 0x0f, 0x07, 0x18, 0x3e, 0x66, 0x62, 0x7e, 0x3c, 0x80, 0xe0,
+    0x38, 0x9c, 0xc6, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x07, 0x03, 0x00, 0x00,
+    0x07, 0x0f, 0x08, 0x0c, 0x0f, 0x03, 0x80, 0xc8, 0xfc, 0x7e, 0xf6, 0xe6, 0x86, 0x06, 0xc0, 0xe0,
+    0xe0, 0x07, 0x0f, 0x0f, 0x0c, 0x0c, 0x0d, 0x0f, 0x07, 0x0f, 0x0f, 0x08, 0x1e, 0x1e, 0x00, 0x00,
+    0xe0, 0xfc, 0xfe, 0x07, 0x01, 0x0f, 0x3f, 0x38, 0x00, 0x0f, 0xfe, 0xf8, 0xc0, 0x20, 0x38, 0x3f,
+    0x0f, 0x01, 0x2c, 0x38, 0xfe, 0x7e, 0x38, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0,
+    0xc0, 0xc0, 0xf8, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3e, 0x0e, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0e, 0x0e, 0x00, 0x00, 0xe0, 0x7c, 0x0e, 0x30, 0x1e, 0x07,
+    0x00, 0x00, 0xf8, 0xfc, 0xfe, 0x06, 0x06, 0x0e, 0xfe, 0xfc, 0xf0, 0x03, 0x07, 0x0f, 0x0c, 0x0c,
+    0x0e, 0x0f, 0x07, 0x01, 0x06, 0x06, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0f, 0x0f,
+    0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x06, 0x06, 0x86, 0xc6, 0xfe, 0x7e, 0x3c, 0x0c, 0x0e, 0x0f, 0x0f,
+    0x0d, 0x0c, 0x0c, 0x0c, 0x04, 0x06, 0x66, 0x66, 0xe6, 0xfe, 0xfe, 0x9c, 0x0c, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0f, 0x0f, 0x07, 0xc0, 0xe0, 0x38, 0x1c, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x03, 0x03, 0x03,
+    0x03, 0x0f, 0x0f, 0x0f, 0x03, 0x03, 0x7e, 0x7e, 0x7e, 0x66, 0x66, 0xe6, 0xe6, 0xc6, 0x0c, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x07, 0xf0, 0xfc, 0xfe, 0x66, 0x66, 0x66, 0xe6, 0xc6, 0x80, 0x03,
+    0x07, 0x0f, 0x0c, 0x0c, 0x0c, 0x0f, 0x07, 0x01, 0x06, 0x06, 0x06, 0x86, 0xe6, 0xfe, 0x7e, 0x0e,
+    0x00, 0x08, 0x0e, 0x0f, 0x07, 0x01, 0x00, 0x00, 0x9c, 0xfe, 0xfe, 0x66, 0x66, 0xfe, 0xfe, 0xbc,
+    0x00, 0x07, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0f, 0x07, 0x03, 0x7c, 0xfe, 0xfe, 0xc6, 0xc6, 0xfe,
+    0xfc, 0xf8, 0x60, 0x04, 0x0c, 0x0c, 0x0c, 0x0c, 0x0e, 0x07, 0x03, 0x00, 0x70, 0x70, 0x0e, 0x0e,
+    0x00, 0x70, 0x70, 0x30, 0x3e, 0x1e, 0x80, 0xc0, 0xc0, 0xe0, 0x60, 0x20, 0x30, 0x30, 0x10, 0x18,
+    0x00, 0x01, 0x01, 0x01, 0x03, 0x03, 0x02, 0x06, 0x06, 0x04, 0x20, 0x60, 0x60, 0x60, 0x60, 0x60,
+    0x60, 0x60, 0x60, 0x60, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x10, 0x18,
+    0x30, 0x30, 0x30, 0x60, 0x60, 0xc0, 0xc0, 0xc0, 0x04, 0x06, 0x06, 0x06, 0x03, 0x03, 0x01, 0x01,
+    0x01, 0x00, 0x0e, 0x06, 0xc6, 0xe6, 0x7e, 0x3e, 0x18, 0x00, 0x0c, 0x0e, 0x0e, 0x00, 0x00, 0x00,
+    0xe0, 0x70, 0x18, 0x8c, 0xe4, 0x66, 0x26, 0x66, 0xe4, 0xec, 0x08, 0xf8, 0xe0, 0x07, 0x0e, 0x18,
+    0x31, 0x27, 0x66, 0x64, 0x66, 0x27, 0x37, 0x04, 0x07, 0x01, 0x00, 0x00, 0xe0, 0xf8, 0x7e, 0x1e,
+    0x3e, 0xfe, 0xf0, 0xc0, 0x00, 0x08, 0x0f, 0x0f, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0f, 0x0e,
+    0xfe, 0xfe, 0xfe, 0x66, 0x66, 0x66, 0xfe, 0xfc, 0x9c, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0f,
+    0x0f, 0x07, 0xf8, 0xfc, 0xfc, 0x0e, 0x06, 0x06, 0x06, 0x06, 0x0e, 0x03, 0x07, 0x0f, 0x0e, 0x0c,
+    0x0c, 0x0c, 0x0c, 0x0e, 0xfe, 0xfe, 0xfe, 0x06, 0x06, 0x06, 0x0e, 0x1c, 0xfc, 0xf8, 0xe0, 0x0f,
+    0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0e, 0x07, 0x07, 0x03, 0x00, 0xfe, 0xfe, 0xfe, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xfe, 0xfe, 0xfe, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xfc, 0xfc, 0x0e, 0x06, 0x06,
+    0xc6, 0xc6, 0xc6, 0xcc, 0x03, 0x07, 0x0f, 0x0e, 0x0c, 0x0c, 0x0c, 0x0f, 0x0f, 0x0f, 0xfe, 0xfe,
+    0xfe, 0x60, 0x60, 0x60, 0x60, 0xfe, 0xfe, 0xfe, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f,
+    0x0f, 0x0f, 0xfe, 0xfe, 0xfe, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x60, 0x60, 0x7f,
+    0x3f, 0x3f, 0xfe, 0xfe, 0xfe, 0xe0, 0xf0, 0xf8, 0x9c, 0x0e, 0x06, 0x02, 0x00, 0x0f, 0x0f, 0x0f,
+    0x00, 0x01, 0x03, 0x07, 0x0f, 0x0e, 0x0c, 0x08, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xfe, 0xfe, 0xfe, 0x1e, 0x7c, 0xe0, 0xc0, 0xf0,
+    0x7c, 0x1e, 0xfe, 0xfe, 0xfe, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x0f,
+    0x0f, 0x0f, 0xfe, 0xfe, 0xfe, 0x1e, 0x78, 0xe0, 0x80, 0xfe, 0xfe, 0xfe, 0x0f, 0x0f, 0x0f, 0x00,
+    0x00, 0x01, 0x07, 0x0f, 0x0f, 0x0f, 0xf8, 0xfc, 0xfe, 0x0e, 0x06, 0x06, 0x06, 0x0e, 0xfc, 0xfc,
+    0xf0, 0x03, 0x07, 0x0f, 0x0e, 0x0c, 0x0c, 0x0c, 0x0e, 0x0f, 0x07, 0x01, 0xfe, 0xfe, 0xfe, 0xc6,
+    0xc6, 0xc6, 0xfe, 0xfc, 0x7c, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xfc,
+    0xfe, 0x0e, 0x06, 0x06, 0x06, 0x0e, 0xfc, 0xfc, 0xf0, 0x03, 0x07, 0x0f, 0x0e, 0x0c, 0x0c, 0x1c,
+    0x3e, 0x37, 0x27, 0x01, 0xfe, 0xfe, 0xfe, 0xc6, 0xc6, 0xc6, 0xfe, 0xfc, 0x3c, 0x00, 0x0f, 0x0f,
+    0x0f, 0x00, 0x00, 0x01, 0x07, 0x0f, 0x0f, 0x0c, 0x3c, 0x7e, 0x7e, 0xe6, 0xe6, 0xe6, 0xc6, 0xce,
+    0x80, 0x06, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0f, 0x07, 0x03, 0x06, 0x06, 0x06, 0x06, 0xfe, 0xfe,
+    0xfe, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0xfe, 0xfe,
+    0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x01, 0x07, 0x0f, 0x0e, 0x0c, 0x0c, 0x0c, 0x0f,
+    0x07, 0x03, 0x02, 0x1e, 0xfe, 0xf8, 0xe0, 0x00, 0x80, 0xf0, 0xfc, 0x7e, 0x0e, 0x00, 0x00, 0x00,
+    0x03, 0x0f, 0x0f, 0x0f, 0x0f, 0x01, 0x00, 0x00, 0x3e, 0xfe, 0xfc, 0x80, 0x80, 0xf8, 0x7e, 0x1e,
+    0xfe, 0xe0, 0x00, 0xe0, 0xfe, 0xfe, 0x0e, 0x00, 0x03, 0x0f, 0x0f, 0x0f, 0x07, 0x00, 0x00, 0x01,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x06, 0x0e, 0xbe, 0xf8, 0xf0, 0xf8, 0xfc, 0x1e, 0x06, 0x02,
+    0x0c, 0x0e, 0x0f, 0x03, 0x01, 0x01, 0x07, 0x0f, 0x0e, 0x08, 0x02, 0x0e, 0x1e, 0x7c, 0xf8, 0xe0,
+    0xf8, 0x3c, 0x1e, 0x06, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x06, 0x86, 0xc6, 0xf6, 0x7e, 0x3e, 0x1e, 0x06, 0x0e, 0x0f, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c,
+    0x0c, 0x0c, 0xfe, 0xff, 0xff, 0x03, 0x02, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x06, 0x3e, 0xf0, 0x80,
+    0x00, 0x00, 0x00, 0x01, 0x0f, 0x3c, 0x03, 0x03, 0xff, 0xff, 0xfe, 0x30, 0x30, 0x3f, 0x3f, 0x3f,
+    0x10, 0x18, 0x0c, 0x0e, 0x06, 0x0e, 0x1c, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x01, 0x03,
+    0x06, 0x00, 0x00, 0x00, 0x30, 0xb0, 0x90, 0x98, 0xb0, 0xf0, 0xf0, 0xe0, 0x07, 0x0f, 0x0d, 0x0c,
+    0x0c, 0x0f, 0x0f, 0x0f, 0xfe, 0xff, 0xff, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xe0, 0x0f, 0x0f, 0x0f,
+    0x04, 0x0c, 0x0c, 0x0f, 0x0f, 0x03, 0xe0, 0xf0, 0xf0, 0x30, 0x38, 0x30, 0x30, 0x07, 0x0f, 0x0f,
+    0x0c, 0x0c, 0x0c, 0x0c, 0xe0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0xff, 0xff, 0xfe, 0x07, 0x0f, 0x0f,
+    0x0c, 0x0c, 0x06, 0x0f, 0x0f, 0x0f, 0xe0, 0xf0, 0xf0, 0xb0, 0x90, 0xb0, 0xf0, 0xe0, 0x80, 0x07,
+    0x0f, 0x0f, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x00, 0x30, 0xf8, 0xfe, 0xfe, 0x37, 0x33, 0x12, 0x00,
+    0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0x07,
+    0x6f, 0x6f, 0x6c, 0x6c, 0x76, 0x7f, 0x3f, 0x0f, 0xfe, 0xff, 0xff, 0x30, 0x30, 0x30, 0xf0, 0xf0,
+    0xc0, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0xf6, 0xf7, 0xf7, 0x0f, 0x0f, 0x0f,
+    0x00, 0x00, 0xf6, 0xf7, 0xf7, 0x40, 0x60, 0x7f, 0x7f, 0x3f, 0xfe, 0xff, 0xff, 0xc0, 0xe0, 0x70,
+    0x30, 0x10, 0x00, 0x0f, 0x0f, 0x0f, 0x01, 0x03, 0x07, 0x0e, 0x0c, 0x08, 0xfe, 0xff, 0xff, 0x0f,
+    0x0f, 0x0f, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xf0, 0xe0, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xc0,
+    0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f, 0xf0, 0xf0,
+    0xf0, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xc0, 0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f,
+    0xe0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0xf0, 0xe0, 0x80, 0x07, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0x0f,
+    0x07, 0x01, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xe0, 0x7f, 0x7f, 0x7f, 0x04, 0x0c,
+    0x0c, 0x0f, 0x0f, 0x03, 0xe0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0xf0, 0x07, 0x0f, 0x0f,
+    0x0c, 0x0c, 0x06, 0x7f, 0x7f, 0x7f, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x0f, 0x0f, 0x0f, 0x00,
+    0x00, 0x00, 0xf0, 0xf0, 0xb0, 0x98, 0x90, 0xb0, 0x30, 0x0c, 0x0c, 0x0d, 0x0d, 0x0d, 0x0f, 0x07,
+    0x30, 0xfc, 0xfe, 0xfe, 0x30, 0x30, 0x30, 0x00, 0x03, 0x0f, 0x0f, 0x0c, 0x0c, 0x0c, 0xf0, 0xf0,
+    0xf0, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0x07, 0x0f, 0x0f, 0x0c, 0x0c, 0x06, 0x0f, 0x0f, 0x0f,
+    0x10, 0x70, 0xf0, 0xc0, 0x00, 0x00, 0xe0, 0xf0, 0x70, 0x00, 0x00, 0x03, 0x0f, 0x0f, 0x0f, 0x0f,
+    0x01, 0x00, 0xf0, 0xf0, 0xe0, 0x00, 0xe0, 0xf0, 0xf0, 0xc0, 0x00, 0xe0, 0xf0, 0x70, 0x00, 0x07,
+    0x0f, 0x0f, 0x0f, 0x00, 0x01, 0x0f, 0x0f, 0x0f, 0x07, 0x00, 0x10, 0x70, 0xf0, 0xc0, 0xe0, 0xf0,
+    0x30, 0x10, 0x0c, 0x0e, 0x07, 0x03, 0x03, 0x0f, 0x0e, 0x08, 0x10, 0x70, 0xf0, 0xe0, 0x00, 0x00,
+    0xe0, 0xf0, 0x30, 0x00, 0x40, 0x61, 0x6f, 0x7f, 0x3f, 0x0f, 0x01, 0x00, 0x30, 0x30, 0xb0, 0xf0,
+    0xf0, 0x70, 0x30, 0x0e, 0x0f, 0x0f, 0x0d, 0x0c, 0x0c, 0x0c, 0x80, 0xc0, 0xfc, 0xfe, 0x3e, 0x03,
+    0x02, 0x01, 0x01, 0x1f, 0x3f, 0x3e, 0x60, 0x20, 0xff, 0xfe, 0xff, 0x7f, 0x03, 0x03, 0x7e, 0xfe,
+    0xf8, 0x80, 0x80, 0x60, 0x60, 0x3f, 0x3f, 0x0f, 0x01, 0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0x80, 0x80, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+};
+
+static const FontGlyph font_sans_16_glyphs[] PROGMEM = {
+    {0, 0, 0, 5}, // space
+    {0, 3, 2, 7}, // !
+    {6, 6, 1, 8}, // "
+    {18, 11, 1, 13}, // #
+    {40, 8, 1, 10}, // $
+    {56, 15, 0, 15}, // %
+    {86, 11, 1, 13}, // &
+    {108, 2, 1, 5}, // '
+    {112, 4, 1, 7}, // (
+    {120, 5, 1, 7}, // )
+    {130, 6, 1, 8}, // *
+    {142, 10, 1, 13}, // +
+    {162, 3, 1, 6}, // ,
+    {168, 5, 1, 6}, // -
+    {178, 3, 1, 6}, // .
+    {184, 5, 0, 5}, // /
+    {194, 9, 1, 10}, // 0
+    {212, 8, 2, 10}, // 1
+    {228, 8, 1, 10}, // 2
+    {244, 8, 1, 10}, // 3
+    {260, 9, 1, 10}, // 4
+    {278, 8, 1, 10}, // 5
+    {294, 9, 1, 10}, // 6
+    {312, 8, 1, 10}, // 7
+    {328, 9, 1, 10}, // 8
+    {346, 9, 1, 10}, // 9
+    {364, 2, 2, 6}, // :
+    {368, 3, 1, 6}, // ;
+    {374, 10, 1, 13}, // <
+    {394, 10, 1, 13}, // =
+    {414, 10, 1, 13}, // >
+    {434, 7, 1, 9}, // ?
+    {448, 13, 1, 15}, // @
+    {474, 11, 0, 12}, // A
+    {496, 9, 1, 11}, // B
+    {514, 9, 1, 11}, // C
+    {532, 11, 1, 12}, // D
+    {554, 8, 1, 10}, // E
+    {570, 8, 1, 10}, // F
+    {586, 10, 1, 12}, // G
+    {606, 10, 1, 13}, // H
+    {626, 3, 1, 6}, // I
+    {632, 5, -1, 6}, // J
+    {642, 11, 1, 12}, // K
+    {664, 8, 1, 10}, // L
+    {680, 13, 1, 15}, // M
+    {706, 10, 1, 13}, // N
+    {726, 11, 1, 13}, // O
+    {748, 9, 1, 11}, // P
+    {766, 11, 1, 13}, // Q
+    {788, 10, 1, 12}, // R
+    {808, 9, 1, 11}, // S
+    {826, 10, 0, 10}, // T
+    {846, 10, 1, 12}, // U
+    {866, 11, 0, 12}, // V
+    {888, 15, 1, 17}, // W
+    {918, 10, 1, 12}, // X
+    {938, 11, 0, 11}, // Y
+    {960, 9, 1, 11}, // Z
+    {978, 5, 1, 7}, // [
+    {988, 5, 0, 5}, // backslash
+    {998, 5, 1, 7}, // ]
+    {1008, 8, 2, 13}, // ^
+    {1024, 7, 0, 8}, // _
+    {1038, 3, 1, 8}, // `
+    {1044, 8, 1, 10}, // a
+    {1060, 9, 1, 11}, // b
+    {1078, 7, 1, 9}, // c
+    {1092, 9, 1, 11}, // d
+    {1110, 9, 1, 10}, // e
+    {1128, 7, 0, 7}, // f
+    {1142, 9, 1, 11}, // g
+    {1160, 9, 1, 11}, // h
+    {1178, 3, 1, 5}, // i
+    {1184, 5, -1, 5}, // j
+    {1194, 9, 1, 10}, // k
+    {1212, 3, 1, 5}, // l
+    {1218, 14, 1, 16}, // m
+    {1246, 9, 1, 11}, // n
+    {1264, 9, 1, 10}, // o
+    {1282, 9, 1, 11}, // p
+    {1300, 9, 1, 11}, // q
+    {1318, 6, 1, 7}, // r
+    {1330, 7, 1, 9}, // s
+    {1344, 7, 0, 7}, // t
+    {1358, 9, 1, 11}, // u
+    {1376, 9, 0, 10}, // v
+    {1394, 12, 1, 14}, // w
+    {1418, 8, 1, 10}, // x
+    {1434, 9, 0, 10}, // y
+    {1452, 7, 1, 9}, // z
+    {1466, 7, 2, 11}, // {
+    {1480, 2, 2, 5}, // |
+    {1484, 7, 2, 11}, // }
+    {1498, 10, 1, 13}, // ~
+};
+
+const Font FONT_SANS_16 = {font_sans_16_bitmap, font_sans_16_glyphs, 0x20, 0x7e, 2, 12};
+
+// DejaVuSans-Bold.ttf at 23 px per em, 24 px line, baseline at row 19: 3504 bytes of glyphs
+static const uint8_t font_sans_24_bitmap[] PROGMEM = {
+    0xfc, 0xfc, 0xfc, 0xfc, 0x8f, 0x9f, 0x9f, 0x9f, 0x07, 0x07, 0x07, 0x07, 0xfc, 0xfc, 0xfc, 0x00,
+    0x00, 0xfc, 0xfc, 0xfc, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xf8, 0xfc, 0xbc, 0x80, 0x80, 0xe0,
+    0xf8, 0xfc, 0x80, 0x80, 0x80, 0x20, 0x70, 0x71, 0xf1, 0xf9, 0xff, 0x7f, 0x73, 0x71, 0xf1, 0xff,
+    0x7f, 0x77, 0x71, 0x71, 0x21, 0x01, 0x00, 0x00, 0x00, 0x07, 0x07, 0x03, 0x00, 0x00, 0x06, 0x07,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0xe0, 0xf0, 0x70, 0xfe, 0xfe, 0x70, 0x70,
+    0x70, 0x60, 0x60, 0x00, 0x87, 0x0f, 0x0f, 0x1e, 0x1e, 0xff, 0xff, 0x1c, 0x3c, 0xfc, 0xf8, 0xf0,
+    0x40, 0x03, 0x07, 0x07, 0x07, 0x07, 0x7f, 0x7f, 0x07, 0x07, 0x07, 0x03, 0x01, 0x00, 0xf0, 0xf8,
+    0xfc, 0x0c, 0x0c, 0x1c, 0xfc, 0xf8, 0xe0, 0x00, 0x00, 0x80, 0xe0, 0xf0, 0x3c, 0x1c, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x06, 0x06, 0x07, 0x87, 0xc3, 0xf0, 0x3c, 0x1e, 0x07, 0xe1,
+    0xf8, 0xf8, 0x1c, 0x0c, 0x0c, 0xfc, 0xf8, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x07, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x07, 0x06, 0x06, 0x07, 0x07, 0x03, 0x00, 0x00, 0x00,
+    0xf0, 0xf8, 0xfc, 0xfc, 0x9c, 0x1c, 0x1c, 0x1c, 0x1c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0xfc, 0xfe, 0xff, 0xcf, 0x07, 0x0f, 0x1f, 0x3f, 0x7c, 0xf8, 0xf0, 0xe0, 0xf8, 0xfe, 0x7e, 0x1e,
+    0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x07, 0x07,
+    0x07, 0x06, 0x04, 0xfc, 0xfc, 0xfc, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf8, 0xfc,
+    0x7e, 0x0e, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x07, 0x1f, 0x3f, 0x3e, 0x30, 0x06, 0x1e,
+    0xfe, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0xc3, 0xff, 0xff, 0xff, 0x3c, 0x20, 0x3c, 0x3f, 0x3f,
+    0x0f, 0x01, 0x00, 0x30, 0x30, 0x60, 0xe0, 0xfc, 0xfc, 0xe0, 0x60, 0x30, 0x30, 0x06, 0x03, 0x03,
+    0x01, 0x1f, 0x1f, 0x01, 0x03, 0x03, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0xff, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x18, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20, 0x3f, 0x3f, 0x1f, 0x07, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf0, 0xfc, 0x1c, 0x00, 0x00, 0xe0, 0xfc,
+    0x7f, 0x0f, 0x00, 0x00, 0x10, 0x1f, 0x1f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xf0, 0xf8,
+    0xfc, 0x3c, 0x1c, 0x1c, 0x3c, 0xfc, 0xf8, 0xf0, 0xe0, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x03, 0x01, 0x00, 0x38, 0x38, 0x38, 0x1c, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x38, 0x3c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0xfc, 0xfc, 0xf8, 0xf0, 0xe0, 0x80, 0xc0, 0xe0, 0xe0, 0xf0, 0x78, 0x3c,
+    0x1f, 0x0f, 0x07, 0x03, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x00, 0x38, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0xfc, 0xfc, 0xf8, 0xf8, 0xe0, 0x00, 0x00,
+    0x00, 0x06, 0x0e, 0x0e, 0x0e, 0x0f, 0x9f, 0xff, 0xff, 0xf9, 0xf0, 0x03, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xf0, 0x78, 0xfc,
+    0xfc, 0xfc, 0xfc, 0xf8, 0x00, 0x00, 0xf8, 0xfc, 0xfe, 0xef, 0xe3, 0xe1, 0xe0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x00, 0x00, 0xf8, 0xfc, 0xfc, 0xfc, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x87,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x8f, 0xff, 0xff, 0xfe, 0xfc, 0x20, 0x03, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0xc0, 0xf0, 0xf8, 0xf8, 0x3c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x38, 0x00, 0x1e, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x07, 0x07, 0x07,
+    0xff, 0xff, 0xfe, 0xfc, 0x70, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x03, 0x01, 0x00, 0x18, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0xfc, 0xfc, 0xfc, 0x3c,
+    0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xfc, 0xff, 0x7f, 0x1f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x07, 0x07, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf8, 0xfc, 0xfc, 0x1c,
+    0x1c, 0x1c, 0x1c, 0xfc, 0xfc, 0xf8, 0xf0, 0x00, 0xe0, 0xf9, 0xfb, 0xff, 0xff, 0x0f, 0x0e, 0x0e,
+    0x0f, 0xff, 0xff, 0xfb, 0xf9, 0x60, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x03, 0x01, 0x00, 0xc0, 0xf0, 0xf8, 0xf8, 0x7c, 0x1c, 0x1c, 0x1c, 0x3c, 0xfc, 0xf8, 0xf0,
+    0xe0, 0x00, 0x03, 0x0f, 0x0f, 0x1f, 0x1f, 0x1c, 0x1c, 0x1c, 0x9e, 0xff, 0xff, 0xff, 0x7f, 0x0e,
+    0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x80, 0xc0,
+    0xc0, 0xc0, 0x80, 0x83, 0x87, 0x87, 0x87, 0x87, 0x07, 0x07, 0x07, 0x07, 0x07, 0x80, 0xc0, 0xc0,
+    0xc0, 0x80, 0x83, 0x87, 0x87, 0x87, 0x87, 0x3f, 0x3f, 0x1f, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x18, 0x3c, 0x3c, 0x3e, 0x7e,
+    0x76, 0x67, 0xe7, 0xe3, 0xc3, 0xc3, 0xc1, 0x81, 0x81, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x81, 0xc1, 0xc1, 0xc3, 0xe3, 0xe7, 0x67, 0x76, 0x7e,
+    0x3e, 0x3c, 0x3c, 0x1c, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x38, 0x38, 0x1c, 0x1c, 0x1c, 0x1c, 0xbc, 0xfc, 0xfc, 0xf8, 0xf0, 0x00, 0x00,
+    0x00, 0x98, 0x9c, 0x9e, 0x9f, 0x0f, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0x70, 0x30, 0x38, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x18, 0x38, 0x30, 0x70, 0xe0, 0xc0, 0x00, 0x30, 0xff, 0xff, 0x01, 0x00, 0x00, 0xfc, 0xfe,
+    0xcf, 0x03, 0x03, 0x03, 0xce, 0xff, 0xff, 0x00, 0x80, 0xc1, 0xff, 0x7f, 0x00, 0x01, 0x07, 0x0e,
+    0x1c, 0x38, 0x30, 0x71, 0x63, 0x63, 0x63, 0x63, 0x61, 0x73, 0x33, 0x3b, 0x13, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xf0, 0xfc, 0xfc, 0x7c, 0xfc, 0xfc, 0xf8, 0xe0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0xe0, 0xfc, 0xff, 0xff, 0xff, 0xe3, 0xe0, 0xe0, 0xe7, 0xff, 0xff, 0xff,
+    0xfc, 0xe0, 0x00, 0x00, 0x04, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x07, 0x07, 0x07, 0x07, 0x04, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x1c, 0x1c, 0x1c, 0x3c, 0xfc,
+    0xf8, 0xf8, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x0e, 0x0e, 0x0f, 0xff, 0xff, 0xff,
+    0xf9, 0xf0, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x00,
+    0x00, 0xc0, 0xf0, 0xf8, 0xf8, 0x78, 0x3c, 0x3c, 0x1c, 0x1c, 0x1c, 0x1c, 0x3c, 0x38, 0x30, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00,
+    0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0xfc, 0xfc, 0xfc,
+    0xfc, 0xfc, 0x3c, 0x3c, 0x3c, 0x3c, 0x38, 0x78, 0xf8, 0xf0, 0xe0, 0xc0, 0x00, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0xfc, 0xfc, 0xfc,
+    0xfc, 0xfc, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x1c, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xf0, 0xf8, 0x78, 0x3c, 0x3c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x3c, 0x38, 0x38, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x80, 0x00, 0x00, 0x0c, 0x1c,
+    0x1c, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x03, 0x03, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0xff,
+    0xff, 0xff, 0xff, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07,
+    0x07, 0x07, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf0, 0xf0, 0xf8, 0x7f, 0x7f, 0x3f, 0x1f, 0x03, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0x80, 0xc0,
+    0xe0, 0xf0, 0xf8, 0x7c, 0x3c, 0x1c, 0x0c, 0x04, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x3f,
+    0x7f, 0xf9, 0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x06, 0x04, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xfc, 0xfc, 0xfc,
+    0xfc, 0xfc, 0xfc, 0xf0, 0x80, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0x0f, 0x7f, 0xfe, 0xf8, 0xfe, 0x3f, 0x0f, 0x03, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xe0, 0x80, 0x00, 0x00,
+    0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x01, 0x03, 0x0f, 0x3f, 0xfe, 0xf8, 0xe0,
+    0xff, 0xff, 0xff, 0xff, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x00, 0xe0, 0xf0, 0xf8, 0xf8, 0x7c, 0x3c, 0x1c, 0x1c, 0x1c, 0x1c, 0x3c, 0xf8,
+    0xf8, 0xf0, 0xe0, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x1c, 0x1c, 0x3c, 0x3c, 0xfc,
+    0xf8, 0xf8, 0xf0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x1c, 0x1f, 0x1f, 0x0f,
+    0x07, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0xf0, 0xf8, 0xf8, 0x7c, 0x3c, 0x1c, 0x1c, 0x1c, 0x1c, 0x3c, 0xf8, 0xf8, 0xf0, 0xe0,
+    0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xff, 0xff,
+    0xff, 0x7f, 0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0x0f, 0x1f, 0x3f, 0x3f, 0x3b,
+    0x21, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x1c, 0x1c, 0x3c, 0x3c, 0xfc, 0xf8, 0xf8, 0xf0,
+    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0x1c, 0x1e, 0x7e, 0xff, 0xff, 0xf3, 0xe1, 0x80,
+    0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x07, 0x07, 0x07, 0x06,
+    0xf0, 0xf8, 0xf8, 0xfc, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x3c, 0x3c, 0x38, 0x00, 0x83, 0x87, 0x07,
+    0x0f, 0x0f, 0x0f, 0x1e, 0x1e, 0xbe, 0xfe, 0xfc, 0xfc, 0xf0, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0xfc, 0xfc,
+    0xfc, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x03, 0x01, 0x00, 0x04, 0x3c, 0xfc, 0xfc, 0xf8, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0xe0, 0xfc, 0xfc, 0xfc, 0x1c, 0x00, 0x00, 0x01, 0x07, 0x3f, 0xff, 0xff, 0xf8, 0xe0, 0xe0, 0xfc,
+    0xff, 0xff, 0x3f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xfc, 0xfc, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x80,
+    0xf8, 0xfc, 0x7c, 0xfc, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0xc0, 0xf8, 0xfc, 0xfc, 0x7c, 0x00, 0x03,
+    0x3f, 0xff, 0xff, 0xfe, 0xe0, 0xf8, 0xff, 0xff, 0x07, 0x00, 0x03, 0x3f, 0xff, 0xfe, 0xe0, 0xf8,
+    0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x0c, 0x1c, 0x3c, 0xfc,
+    0xf8, 0xf0, 0xc0, 0x80, 0x80, 0xe0, 0xf0, 0xfc, 0x7c, 0x3c, 0x1c, 0x04, 0x00, 0x00, 0xc0, 0xe0,
+    0xf9, 0xff, 0x7f, 0x3f, 0x3f, 0xff, 0xff, 0xf1, 0xe0, 0x80, 0x00, 0x00, 0x06, 0x07, 0x07, 0x07,
+    0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x07, 0x07, 0x07, 0x04, 0x04, 0x1c, 0x3c, 0xfc,
+    0xfc, 0xf0, 0xe0, 0x80, 0x00, 0xc0, 0xe0, 0xf8, 0xfc, 0x7c, 0x3c, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0xbc, 0xfc, 0xfc, 0xfc, 0xfc, 0x7c, 0x3c, 0x08, 0x00, 0x80, 0xe0, 0xf0, 0xf8,
+    0xfc, 0x3e, 0x1f, 0x0f, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xfe, 0xfe, 0xfe, 0xfe, 0x0e, 0x0e, 0x0e,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x38, 0x38, 0x38, 0x0c, 0x7c,
+    0xf8, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1f, 0xfe, 0xf0, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x0f, 0x1f, 0x1c, 0x0c, 0x0e, 0x0e, 0x0e, 0xfe, 0xfe, 0xfe, 0xfc, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x30, 0x38, 0x38, 0x38, 0x3f, 0x3f, 0x3f, 0x3f, 0x80, 0xc0,
+    0xe0, 0x70, 0x78, 0x3c, 0x1c, 0x3c, 0x78, 0x70, 0xe0, 0xc0, 0x80, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x03, 0x07, 0x0e, 0x1c, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0x80, 0x80, 0x00, 0x00, 0xe0, 0xf3, 0xf9, 0xf9, 0x39, 0x39, 0x19, 0x19, 0x9b, 0xff, 0xff,
+    0xff, 0xfc, 0x01, 0x03, 0x07, 0x07, 0x07, 0x06, 0x06, 0x03, 0x03, 0x07, 0x07, 0x07, 0x07, 0xfe,
+    0xfe, 0xfe, 0xfe, 0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0xff, 0x83, 0x01, 0x01, 0x01, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x07, 0x07, 0x07, 0x07, 0x03,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0x80, 0xfc, 0xff, 0xff, 0xff, 0xc7, 0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00,
+    0x01, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xc0,
+    0xc0, 0x80, 0x80, 0xfc, 0xfe, 0xfe, 0xfe, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0x87, 0x01, 0x01, 0x01,
+    0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x00,
+    0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xbb, 0x39, 0x39, 0x39, 0x39, 0x3f, 0x3f, 0x3f, 0xbe, 0x10,
+    0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x07, 0x06, 0x06, 0x07, 0x07, 0x07, 0x03, 0x00, 0x80, 0xc0,
+    0xf0, 0xf8, 0xfc, 0xfc, 0xfe, 0xce, 0xce, 0xce, 0x01, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
+    0x01, 0x01, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0,
+    0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0x80, 0x7c, 0xff, 0xff, 0xff, 0xc7, 0x01,
+    0x01, 0x01, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x61, 0xe3, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
+    0xf3, 0x7f, 0x7f, 0x3f, 0x1f, 0x07, 0xfe, 0xfe, 0xfe, 0xfe, 0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xc0,
+    0x80, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x07, 0x01, 0x01, 0x01, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0xde, 0xde, 0xde,
+    0xde, 0xff, 0xff, 0xff, 0xff, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0xde, 0xde, 0xde, 0xde,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0x7f, 0x1f, 0xfe, 0xfe,
+    0xfe, 0xfe, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0x00, 0xff, 0xff, 0xff, 0xff, 0x3c,
+    0x7e, 0xff, 0xef, 0xc7, 0x83, 0x01, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x03,
+    0x07, 0x07, 0x07, 0x06, 0x04, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x07, 0x07, 0x07,
+    0x07, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x80, 0x80, 0xc0,
+    0xc0, 0xc0, 0xc0, 0x80, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x01, 0x01, 0x03, 0xff, 0xff, 0xff,
+    0xff, 0x07, 0x01, 0x01, 0x03, 0xff, 0xff, 0xff, 0xff, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0xc0, 0xc0, 0xc0,
+    0xc0, 0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x07, 0x01,
+    0x01, 0x01, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80,
+    0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x87, 0x01, 0x01, 0x01, 0x03, 0xff, 0xff, 0xff, 0xff, 0x7c,
+    0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x01, 0x00, 0xc0, 0xc0,
+    0xc0, 0xc0, 0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0x83, 0x01, 0x01, 0x01, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x10, 0xff, 0xff, 0xff, 0xff, 0x03, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0x80,
+    0x80, 0x80, 0xc0, 0xc0, 0xc0, 0x80, 0xfc, 0xff, 0xff, 0xff, 0x87, 0x01, 0x01, 0x01, 0x03, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x7f, 0xff, 0xff,
+    0xff, 0x7f, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x07,
+    0x03, 0x03, 0x01, 0x03, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x0f, 0x1f, 0x1f, 0x3f, 0x39, 0x39, 0x39,
+    0x79, 0xf1, 0xf1, 0xf3, 0xc0, 0x03, 0x07, 0x07, 0x07, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 0x03,
+    0x00, 0x80, 0xc0, 0xf8, 0xf8, 0xf8, 0xf8, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x01, 0x01, 0xff, 0xff,
+    0xff, 0xff, 0x81, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07,
+    0x07, 0x00, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xc0, 0x80, 0xff,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x03, 0x07, 0x07, 0x07, 0x07, 0x07, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xc0, 0xc0, 0xc0, 0x01, 0x0f, 0x7f, 0xff, 0xfc, 0xf0, 0xc0, 0xf0, 0xfc, 0xff,
+    0x3f, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x01, 0x00, 0x00, 0x00,
+    0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x80,
+    0xc0, 0xc0, 0xc0, 0x01, 0x1f, 0xff, 0xff, 0xfe, 0xc0, 0xf0, 0xff, 0x7f, 0x07, 0x3f, 0xff, 0xf8,
+    0xc0, 0xf8, 0xff, 0xff, 0x3f, 0x03, 0x00, 0x00, 0x01, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00,
+    0x00, 0x03, 0x07, 0x07, 0x07, 0x07, 0x03, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00,
+    0x00, 0x80, 0xc0, 0xc0, 0xc0, 0x40, 0x00, 0x01, 0x83, 0xef, 0xff, 0xfe, 0x7c, 0xfe, 0xff, 0xcf,
+    0x83, 0x01, 0x00, 0x06, 0x07, 0x07, 0x07, 0x03, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x07, 0x04,
+    0xc0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xc0, 0x01, 0x0f, 0x3f,
+    0xff, 0xfe, 0xf0, 0xc0, 0xe0, 0xfc, 0xff, 0x3f, 0x0f, 0x01, 0x00, 0xe0, 0xe0, 0xe0, 0xf7, 0xff,
+    0x7f, 0x3f, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0x01, 0x81, 0xc1, 0xe1, 0xf1, 0x7d, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0xf0, 0xf8, 0xfc, 0xfc, 0x1e,
+    0x0e, 0x0e, 0x0c, 0x38, 0x38, 0x3c, 0xff, 0xff, 0xff, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x3f, 0x3f, 0x7f, 0x78, 0x70, 0x70, 0x20, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0e, 0x0e, 0x0e, 0xfc, 0xfc, 0xfc, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc7, 0xff, 0xff, 0xff, 0x3c, 0x38, 0x38, 0x18, 0x70, 0x70, 0x70, 0x7f, 0x3f, 0x3f, 0x1f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x18, 0x1c, 0x0c, 0x0c, 0x1c, 0x1c, 0x1c, 0x18, 0x38, 0x38, 0x38, 0x38, 0x1c,
+    0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const FontGlyph font_sans_24_glyphs[] PROGMEM = {
+    {0, 0, 0, 8}, // space
+    {0, 4, 3, 10}, // !
+    {12, 8, 2, 12}, // "
+    {36, 17, 1, 19}, // #
+    {87, 13, 2, 16}, // $
+    {126, 21, 1, 23}, // %
+    {189, 18, 1, 20}, // &
+    {243, 3, 2, 7}, // '
+    {252, 6, 2, 11}, // (
+    {270, 7, 2, 11}, // )
+    {291, 10, 1, 12}, // *
+    {321, 15, 2, 19}, // +
+    {366, 6, 1, 9}, // ,
+    {384, 7, 1, 10}, // -
+    {405, 5, 2, 9}, // .
+    {420, 8, 0, 8}, // /
+    {444, 14, 1, 16}, // 0
+    {486, 13, 2, 16}, // 1
+    {525, 12, 2, 16}, // 2
+    {561, 13, 1, 16}, // 3
+    {600, 14, 1, 16}, // 4
+    {642, 13, 2, 16}, // 5
+    {681, 14, 1, 16}, // 6
+    {723, 13, 1, 16}, // 7
+    {762, 14, 1, 16}, // 8
+    {804, 14, 1, 16}, // 9
+    {846, 5, 2, 9}, // :
+    {861, 5, 2, 9}, // ;
+    {876, 15, 2, 19}, // <
+    {921, 15, 2, 19}, // =
+    {966, 15, 2, 19}, // >
+    {1011, 11, 1, 13}, // ?
+    {1044, 20, 1, 23}, // @
+    {1104, 18, 0, 18}, // A
+    {1158, 14, 2, 18}, // B
+    {1200, 15, 1, 17}, // C
+    {1245, 16, 2, 19}, // D
+    {1293, 12, 2, 16}, // E
+    {1329, 12, 2, 16}, // F
+    {1365, 16, 1, 19}, // G
+    {1413, 15, 2, 19}, // H
+    {1458, 5, 2, 9}, // I
+    {1473, 8, -1, 9}, // J
+    {1497, 16, 2, 18}, // K
+    {1545, 12, 2, 15}, // L
+    {1581, 19, 2, 23}, // M
+    {1638, 15, 2, 19}, // N
+    {1683, 17, 1, 20}, // O
+    {1734, 14, 2, 17}, // P
+    {1776, 17, 1, 20}, // Q
+    {1827, 15, 2, 18}, // R
+    {1872, 13, 2, 17}, // S
+    {1911, 16, 0, 16}, // T
+    {1959, 15, 2, 19}, // U
+    {2004, 17, 0, 18}, // V
+    {2055, 23, 1, 25}, // W
+    {2124, 16, 1, 18}, // X
+    {2172, 16, 0, 17}, // Y
+    {2220, 15, 1, 17}, // Z
+    {2265, 7, 2, 11}, // [
+    {2286, 8, 0, 8}, // backslash
+    {2310, 8, 1, 11}, // ]
+    {2334, 13, 3, 19}, // ^
+    {2373, 12, 0, 12}, // _
+    {2409, 5, 2, 12}, // `
+    {2424, 13, 1, 16}, // a
+    {2463, 14, 2, 16}, // b
+    {2505, 11, 1, 14}, // c
+    {2538, 14, 1, 16}, // d
+    {2580, 14, 1, 16}, // e
+    {2622, 10, 0, 10}, // f
+    {2652, 14, 1, 16}, // g
+    {2694, 13, 2, 16}, // h
+    {2733, 4, 2, 8}, // i
+    {2745, 7, -1, 8}, // j
+    {2766, 13, 2, 15}, // k
+    {2805, 4, 2, 8}, // l
+    {2817, 20, 2, 24}, // m
+    {2877, 13, 2, 16}, // n
+    {2916, 14, 1, 16}, // o
+    {2958, 14, 2, 16}, // p
+    {3000, 14, 1, 16}, // q
+    {3042, 9, 2, 11}, // r
+    {3069, 12, 1, 14}, // s
+    {3105, 11, 0, 11}, // t
+    {3138, 13, 2, 16}, // u
+    {3177, 13, 1, 15}, // v
+    {3216, 19, 1, 21}, // w
+    {3273, 13, 1, 15}, // x
+    {3312, 13, 1, 15}, // y
+    {3351, 11, 1, 13}, // z
+    {3384, 11, 3, 16}, // {
+    {3417, 3, 3, 8}, // |
+    {3426, 11, 3, 16}, // }
+    {3459, 15, 2, 19}, // ~
+};
+
+const Font FONT_SANS_24 = {font_sans_24_bitmap, font_sans_24_glyphs, 0x20, 0x7e, 3, 19};
@@ -0,0 +1,71 @@
+#include "fonts.h"
+#include "font_data.h"
+
+static const FontGlyph &glyphFor(const Font &font, char ch)
+{
+    uint8_t c = (uint8_t)ch;
+    if (c < font.first || c > font.last)
+        c = '?';
+    return font.glyphs[c - font.first];
+}
+
+int fontTextWidth(const Font &font, const char *text)
+{
+    int pen = 0;
+    int right = 0;
+    for (; *text; text++)
+    {
+        const FontGlyph &g = glyphFor(font, *text);
+        if (g.width && pen + g.xOffset + g.width > right)
+            right = pen + g.xOffset + g.width;
+        pen += g.advance;
+    }
+    return right;
+}
+
+int16_t fontDrawText(Adafruit_SSD1306 &gfx, const Font &font, int16_t x, int16_t y, const char *text)
+{
+    uint8_t *buf = gfx.getBuffer();
+    const int W = gfx.width();
+    const int pages = gfx.height() / 8;
+    // Line top as a page plus a bit shift; a glyph byte then lands in at
+    // most two framebuffer bytes.
+    int page0 = y >= 0 ? y / 8 : (y - 7) / 8;
+    int shift = y - page0 * 8;
+
+    for (; *text; text++)
+    {
+        const FontGlyph &g = glyphFor(font, *text);
+        int gx = x + g.xOffset;
+        x += g.advance;
+        int c0 = gx < 0 ? -gx : 0;
+        int c1 = gx + g.width > W ? W - gx : g.width;
+        if (c0 >= c1)
+            continue;
+        const uint8_t *src = font.bitmap + g.offset;
+        for (int p = 0; p < font.pages; p++, src += g.width)
+        {
+            int dp = page0 + p;
+            if (shift == 0)
+            {
+                if (dp < 0 || dp >= pages)
+                    continue;
+                uint8_t *dst = buf + dp * W;
+                for (int c = c0; c < c1; c++)
+                    dst[gx + c] |= src[c];
+                continue;
+            }
+            uint8_t *lo = dp >= 0 && dp < pages ? buf + dp * W : nullptr;
+            uint8_t *hi = dp + 1 >= 0 && dp + 1 < pages ? buf + (dp + 1) * W : nullptr;
+            for (int c = c0; c < c1; c++)
+            {
+                uint8_t b = src[c];
+                if (lo)
+                    lo[gx + c] |= (uint8_t)(b << shift);
+                if (hi)
+                    hi[gx + c] |= (uint8_t)(b >> (8 - shift));
+            }
+        }
+    }
+    return x;
+}
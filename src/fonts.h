@@ -0,0 +1,38 @@
+// fonts.h
+// Pre-rasterized bitmap fonts for the OLED, generated into font_data.h by
+// scripts/gen_fonts.py. Glyphs are stored in the SSD1306 page-major layout
+// (a byte is 8 vertical pixels, LSB on top), so drawing copies bytes into the
+// framebuffer instead of plotting scaled 5x7 GFX glyphs pixel by pixel, and
+// widths come from per-glyph metrics instead of len * 6 * size.
+#pragma once
+
+#include <stdint.h>
+#include <Adafruit_SSD1306.h>
+
+struct FontGlyph
+{
+    uint16_t offset; // into Font::bitmap
+    uint8_t width;   // ink columns; `pages` rows of `width` bytes
+    int8_t xOffset;  // first ink column, relative to the pen
+    uint8_t advance; // pen movement
+};
+
+struct Font
+{
+    const uint8_t *bitmap;
+    const FontGlyph *glyphs;
+    uint8_t first, last; // character range; others draw as '?'
+    uint8_t pages;       // line height in 8-pixel pages
+    uint8_t baseline;    // baseline row, from the top of the line
+};
+
+// DejaVu Sans Bold with 16 and 24 pixel lines.
+extern const Font FONT_SANS_16;
+extern const Font FONT_SANS_24;
+
+// Pixels from the pen position to the right edge of the last ink column.
+int fontTextWidth(const Font &font, const char *text);
+// OR text into the framebuffer with the top of its line at y; rows that are
+// a multiple of 8 take the byte-aligned path. Clipped to the panel; assumes
+// rotation 0. Returns the pen position after the text.
+int16_t fontDrawText(Adafruit_SSD1306 &gfx, const Font &font, int16_t x, int16_t y, const char *text);
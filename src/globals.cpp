@@ -2,9 +2,6 @@
 
 // Define globals declared in globals.h
 Config cfg;
+Config uiCfg;
 Preferences prefs;
 RotaryEncoder *encoder = nullptr;
-int menuIndex = 0;
-Adafruit_AHTX0 *aht20 = nullptr;
-Adafruit_BMP280 *bmp280 = nullptr;
-unsigned long lastEncoderActivity = 0;
@@ -5,13 +5,12 @@
 #include "config.h"
 #include "encoder.h"
 #include <Preferences.h>
-#include <Adafruit_AHTX0.h>
-#include <Adafruit_BMP280.h>
 
+// The running config, one copy per core (see cores.h): cfg is read and
+// updated by the network side, uiCfg by the UI side. Both follow the
+// published config snapshot.
 extern Config cfg;
+extern Config uiCfg;
 extern Preferences prefs;
+// UI core only.
 extern RotaryEncoder *encoder;
-extern int menuIndex;
-extern Adafruit_AHTX0 *aht20;
-extern Adafruit_BMP280 *bmp280;
-extern unsigned long lastEncoderActivity;
@@ -6,15 +6,144 @@
 #include <ArduinoOTA.h>
 #include "led.h"
 #include "system.h"
+#include "button.h"
 #include "config.h"
 #include "globals.h"
 #include "provisioning.h"
+#include "status_server.h"
 #include "display.h"
+#include "logger.h"
+#include "metrics.h"
+#include "fast_connect.h"
+#include "wifi_link.h"
+#include "sensors.h"
+
+// Set once tryConnectWifi() has brought up the STA-side subsystems (before
+// the net task starts); config changes are only applied live after that.
+static bool staServicesStarted = false;
+// Snapshot generation each core's subsystems were configured from.
+static uint32_t netAppliedGeneration = 0;
+static uint32_t uiAppliedGeneration = 0;
+
+static void startOta()
+{
+    ArduinoOTA.setHostname(cfg.devname);
+    // An empty password disables OTA authentication; set it unconditionally
+    // so a reload can also clear a previous password.
+    ArduinoOTA.setPassword(cfg.ota_password);
+    ArduinoOTA.begin();
+    Serial.println("ArduinoOTA started");
+}
+
+static void startEncoder()
+{
+    if (!uiCfg.encoder_enabled)
+        return;
+    encoder = new RotaryEncoder(uiCfg.encoder_clk_pin, uiCfg.encoder_dt_pin, uiCfg.encoder_sw_pin,
+                                uiCfg.encoder_accel);
+    encoder->begin();
+    Serial.println("Encoder initialized");
+}
+
+static void stopEncoder()
+{
+    delete encoder;
+    encoder = nullptr;
+}
+
+static void startMdns()
+{
+    if (!cfg.mdns_enable)
+        return;
+    if (MDNS.begin(cfg.devname))
+    {
+        MDNS.addService("http", "tcp", 80);
+        Serial.println("mDNS started");
+    }
+    else
+    {
+        Serial.println("mDNS failed to start");
+    }
+}
+
+void applyNetConfigChanges()
+{
+    // While the fallback portal runs the STA services are stopped; the
+    // portal's own save path reboots the device.
+    if (!staServicesStarted || isProvisioningActive())
+        return;
+    uint32_t gen = configGeneration();
+    if (gen == netAppliedGeneration)
+        return;
+    netAppliedGeneration = gen;
+
+    std::shared_ptr<const ConfigSnapshot> snap = configSnapshot();
+    Config prev = cfg;
+    cfg = snap->cfg;
+    logSetLevel(cfg.log_level);
+    uint8_t impact = configDiff(prev, cfg);
+    if (impact == CFG_IMPACT_NONE)
+        return;
+    Serial.printf("Config generation %lu: applying changes (impact 0x%02x)\n", (unsigned long)gen, impact);
+
+    if (impact & CFG_IMPACT_REBOOT)
+    {
+        // Wi-Fi credentials cannot be swapped under a live connection
+        // without losing the status server anyway; reboot cleanly.
+        Serial.println("Wi-Fi credentials or IP settings changed; rebooting to apply");
+        scheduleRestart(1000);
+        return;
+    }
+    // ArduinoOTA.end() also stops the mDNS responder it shares, so an OTA
+    // restart always implies an mDNS restart.
+    if (impact & CFG_IMPACT_OTA)
+        impact |= CFG_IMPACT_MDNS;
+    if (impact & CFG_IMPACT_OTA)
+    {
+        ArduinoOTA.end();
+        startOta();
+    }
+    if (impact & CFG_IMPACT_MDNS)
+    {
+        MDNS.end();
+        startMdns();
+    }
+}
+
+void applyUiConfigChanges()
+{
+    if (!staServicesStarted)
+        return;
+    uint32_t gen = configGeneration();
+    if (gen == uiAppliedGeneration)
+        return;
+    uiAppliedGeneration = gen;
+
+    std::shared_ptr<const ConfigSnapshot> snap = configSnapshot();
+    Config prev = uiCfg;
+    uiCfg = snap->cfg;
+    // Changes that need a reboot are left to applyNetConfigChanges().
+    uint8_t impact = configDiff(prev, uiCfg);
+    if (impact & CFG_IMPACT_ENCODER)
+    {
+        stopEncoder();
+        startEncoder();
+        displayResetMenu();
+    }
+    if (impact & CFG_IMPACT_CLIMATE)
+        sensorsStop();
+    if (impact & CFG_IMPACT_DISPLAY)
+        displayInit(uiCfg); // also restarts the shared I2C bus on new pins
+    if (impact & CFG_IMPACT_CLIMATE)
+        sensorsStart(uiCfg);
+}
 
 bool initSerial()
 {
     Serial.begin(115200);
     delay(20);
+    logInit();
+    metricsInit();
     return true;
 }
 
@@ -52,93 +181,173 @@ bool initFileSystem()
     return true;
 }
 
+// The UI side reads its copy before the schedulers start: buttonTask() runs
+// inside waitForWifi() and needs reset_hold_seconds from the loaded config.
+static bool configLoaded()
+{
+    logSetLevel(cfg.log_level);
+    uiCfg = cfg;
+    return true;
+}
+
 bool tryLoadConfig()
 {
+    // Fast path: packed image in NVS, no LittleFS mount or JSON parse.
+    if (loadConfigCached(cfg))
+    {
+        Serial.println("Config loaded from NVS cache");
+        return configLoaded();
+    }
+    // Slow path: mount (formatting if needed) and parse /config.json. This
+    // also re-primes the NVS image for the next boot.
+    if (!initFileSystem())
+    {
+        // Filesystem unavailable; fall back to provisioning
+        startProvisioning();
+        return false;
+    }
     if (!loadConfig(cfg))
     {
         Serial.println("No config found, entering provisioning mode...");
         startProvisioning();
         return false;
     }
-    return true;
+    return configLoaded();
 }
 
-bool tryConnectWifi(unsigned long timeoutMs)
+void bootMark(const char *phase)
 {
-    Serial.println("Loaded config; attempting to connect to WiFi...");
-    WiFi.mode(WIFI_STA);
-    WiFi.begin(cfg.ssid.c_str(), cfg.psk.c_str());
+    static unsigned long last = 0;
+    unsigned long now = millis();
+    Serial.printf("[boot %5lu ms, +%4lu] %s\n", now, now - last, phase);
+    last = now;
+}
 
-    unsigned long start = millis();
+// How long a directed connect to the cached AP may take before falling back
+// to a full scan.
+static const unsigned long FAST_CONNECT_TIMEOUT_MS = 3000;
+
+enum class WifiWait : uint8_t
+{
+    Connected,
+    TimedOut,
+};
+
+// Poll until connected or timeoutMs after start. The schedulers are not
+// running yet, so the BOOT button is serviced here; a factory reset
+// restarts the device from inside buttonTask().
+static WifiWait waitForWifi(unsigned long start, unsigned long timeoutMs)
+{
     while (millis() - start < timeoutMs)
     {
         if (WiFi.status() == WL_CONNECTED)
-            break;
-        if (checkFactoryReset())
-            return false; // factoryResetAction will restart
-        delay(200);
+            return WifiWait::Connected;
+        buttonTask();
+        delay(BUTTON_POLL_MS);
     }
+    return WiFi.status() == WL_CONNECTED ? WifiWait::Connected : WifiWait::TimedOut;
+}
 
-    if (WiFi.status() == WL_CONNECTED)
+bool tryConnectWifi(unsigned long timeoutMs)
+{
+    Serial.println("Loaded config; attempting to connect to WiFi...");
+    WiFi.mode(WIFI_STA);
+    // Directed connect to the last AP (no channel scan), optionally on the
+    // last DHCP lease; a static IP from the config always wins.
+    FastConnectInfo fast;
+    bool useFast = cfg.wifi_fast_connect > 0 && loadFastConnect(cfg, fast);
+    applyIpConfig(cfg, useFast && cfg.wifi_fast_connect >= 2 ? &fast : nullptr);
+    if (useFast)
+        WiFi.begin(cfg.ssid, cfg.psk, fast.channel, fast.bssid);
+    else
+        WiFi.begin(cfg.ssid, cfg.psk);
+    bootMark(useFast ? "WiFi.begin (cached AP)" : "WiFi.begin (scan)");
+
+    // The NVS fast path skipped the filesystem; mount it while the radio
+    // associates (the status server serves /config from it). If config.json
+    // no longer matches the cached image it was replaced out-of-band (e.g.
+    // uploadfs), so drop the cache and reboot onto the JSON path. If it is
+    // gone (a mount failure formatted the partition), the cache is the only
+    // copy left: write it back instead of falling into provisioning.
+    if (initFileSystem())
     {
-        Serial.print("Connected as STA, IP: ");
-        Serial.println(WiFi.localIP());
-        startStatusServer();
-        // Initialize ArduinoOTA
-        ArduinoOTA.setHostname(cfg.devname.c_str());
-        if (!cfg.ota_password.isEmpty())
+        switch (configCacheState())
         {
-            ArduinoOTA.setPassword(cfg.ota_password.c_str());
-        }
-        ArduinoOTA.begin();
-        Serial.println("ArduinoOTA started");
-        if (cfg.encoder_enabled)
-        {
-            encoder = new RotaryEncoder(cfg.encoder_clk_pin, cfg.encoder_dt_pin, cfg.encoder_sw_pin);
-            encoder->begin();
-            Serial.println("Encoder initialized");
-        }
-        displayInit(cfg);
-        displaySplashScreen(cfg, true);
-        if (cfg.climate_enabled)
-        {
-            aht20 = new Adafruit_AHTX0();
-            bmp280 = new Adafruit_BMP280();
-            if (aht20->begin())
-            {
-                Serial.println("AHT20 initialized");
-            }
-            else
-            {
-                Serial.println("AHT20 failed to initialize");
-            }
-            if (bmp280->begin(0x77)) // BMP280 default address
-            {
-                Serial.println("BMP280 initialized");
-            }
-            else
-            {
-                Serial.println("BMP280 failed to initialize");
-            }
+        case ConfigCacheState::Stale:
+            Serial.println("config.json changed since NVS cache was written; rebooting to reload");
+            invalidateConfigCache();
+            delay(100);
+            ESP.restart();
+            break;
+        case ConfigCacheState::FileMissing:
+            Serial.println("config.json missing; restoring it from the NVS cache");
+            if (!saveConfig(cfg))
+                Serial.println("Warning: could not restore config.json");
+            break;
+        case ConfigCacheState::Current:
+            break;
         }
-        if (cfg.mdns_enable)
+    }
+    bootMark("filesystem mounted");
+
+    unsigned long start = millis();
+    WifiWait result = WifiWait::TimedOut;
+    if (useFast)
+    {
+        result = waitForWifi(start, FAST_CONNECT_TIMEOUT_MS);
+        if (result == WifiWait::TimedOut)
         {
-            if (MDNS.begin(cfg.devname.c_str()))
-            {
-                MDNS.addService("http", "tcp", 80);
-                Serial.println("mDNS started");
-            }
-            else
-            {
-                Serial.println("mDNS failed to start");
-            }
+            // The AP moved, changed channel or the lease was refused.
+            Serial.println("Cached AP did not answer; falling back to a full scan");
+            clearFastConnect();
+            WiFi.disconnect();
+            applyIpConfig(cfg, nullptr);
+            WiFi.begin(cfg.ssid, cfg.psk);
+            bootMark("WiFi.begin (scan)");
         }
-        return true;
+    }
+    if (result == WifiWait::TimedOut)
+        result = waitForWifi(start, timeoutMs);
+
+    bool connected = result == WifiWait::Connected;
+    if (connected)
+    {
+        bootMark("WiFi connected");
+        Serial.print("Connected as STA, IP: ");
+        Serial.println(WiFi.localIP());
+        if (cfg.wifi_fast_connect > 0)
+            saveFastConnect(cfg);
     }
     else
     {
-        Serial.println("Failed to connect, starting provisioning AP...");
-        startProvisioning();
-        return false;
+        // A router reboot or a power cut that took the AP down too should not
+        // strand the device in the portal; the link supervisor keeps retrying
+        // and only opens the AP after ap_fallback_minutes.
+        Serial.println("Failed to connect; retrying in the background");
     }
+    startStatusServer();
+    bootMark("status server up");
+    startOta();
+    startMdns();
+    startEncoder();
+    displayInit(uiCfg);
+    displaySplash();
+    sensorsStart(uiCfg);
+    staServicesStarted = true;
+    netAppliedGeneration = uiAppliedGeneration = configGeneration();
+    wifiLinkBegin(connected);
+    return connected;
+}
+
+void restartNetworkServices()
+{
+    if (!staServicesStarted)
+        return;
+    // ArduinoOTA.end() also stops mDNS, see applyNetConfigChanges().
+    ArduinoOTA.end();
+    startOta();
+    MDNS.end();
+    startMdns();
+    stopStatusServer();
+    startStatusServer();
 }
@@ -6,7 +6,25 @@ bool initSerial();
 bool initPins();
 bool initLedAndSystem();
 bool initFileSystem();
-// Returns true if config loaded successfully. If false, provisioning should start.
+// Loads cfg from the NVS fast-path image, falling back to mounting LittleFS and
+// parsing /config.json. Returns true if config loaded successfully; if false,
+// provisioning has been started.
 bool tryLoadConfig();
-// Attempt to connect to WiFi using cfg; returns true if connected.
+// Print a boot-phase timestamp (ms since reset, and since the previous mark)
+// to Serial, for measuring connect time.
+void bootMark(const char *phase);
+// Attempt to connect to WiFi using cfg (directed to the cached AP first, see
+// fast_connect.h); returns true if connected. The STA services start either
+// way and wifi_link.h takes over reconnects.
 bool tryConnectWifi(unsigned long timeoutMs = 15000);
+// Restart OTA, mDNS and the status server after the station link came back,
+// so they rebind to the (possibly new) IP.
+void restartNetworkServices();
+// Scheduler tasks: once STA services are running, pick up a newly saved
+// config (e.g. from PATCH /config), diff it against the running one and
+// re-initialize only the affected subsystems. Each core applies its own
+// share (see cores.h): the net side OTA, mDNS and log level, and it schedules
+// a reboot for Wi-Fi credential changes; the UI side the encoder, display
+// and sensors.
+void applyNetConfigChanges();
+void applyUiConfigChanges();
@@ -0,0 +1,191 @@
+#include "json_writer.h"
+#include <stdio.h>
+
+JsonWriter::JsonWriter(char *buf, size_t cap, Sink sink, void *ctx)
+    : buf(buf), cap(cap), len(0), total(0), sink(sink), ctx(ctx), failed(cap == 0), afterKey(false), depth(0),
+      hasItem(0)
+{
+}
+
+bool JsonWriter::drain()
+{
+    if (len == 0)
+        return true;
+    if (!sink(ctx, buf, len))
+        return false;
+    total += len;
+    len = 0;
+    return true;
+}
+
+void JsonWriter::put(char c)
+{
+    if (failed)
+        return;
+    // Buffer mode keeps one byte for the terminating NUL.
+    size_t limit = sink ? cap : cap - 1;
+    if (len >= limit && (!sink || !drain()))
+    {
+        failed = true;
+        return;
+    }
+    buf[len++] = c;
+}
+
+void JsonWriter::puts(const char *s)
+{
+    while (*s)
+        put(*s++);
+}
+
+// Emit the comma before a value or key unless it directly follows a key or
+// is the first member of its container.
+void JsonWriter::separate()
+{
+    if (afterKey)
+    {
+        afterKey = false;
+        return;
+    }
+    if (depth == 0)
+        return;
+    uint32_t bit = 1UL << depth;
+    if (hasItem & bit)
+        put(',');
+    hasItem |= bit;
+}
+
+void JsonWriter::open(char c)
+{
+    separate();
+    if (depth >= MAX_DEPTH)
+    {
+        failed = true;
+        return;
+    }
+    put(c);
+    ++depth;
+    hasItem &= ~(1UL << depth);
+}
+
+void JsonWriter::close(char c)
+{
+    if (depth == 0)
+    {
+        failed = true;
+        return;
+    }
+    --depth;
+    put(c);
+}
+
+JsonWriter &JsonWriter::beginObject()
+{
+    open('{');
+    return *this;
+}
+
+JsonWriter &JsonWriter::endObject()
+{
+    close('}');
+    return *this;
+}
+
+JsonWriter &JsonWriter::beginArray()
+{
+    open('[');
+    return *this;
+}
+
+JsonWriter &JsonWriter::endArray()
+{
+    close(']');
+    return *this;
+}
+
+JsonWriter &JsonWriter::key(const char *name)
+{
+    str(name);
+    put(':');
+    afterKey = true;
+    return *this;
+}
+
+JsonWriter &JsonWriter::str(const char *s)
+{
+    separate();
+    put('"');
+    for (; *s; ++s)
+    {
+        char c = *s;
+        if (c == '"' || c == '\\')
+        {
+            put('\\');
+            put(c);
+        }
+        else if ((uint8_t)c < 0x20)
+        {
+            char tmp[7];
+            snprintf(tmp, sizeof(tmp), "\\u%04x", (unsigned)(uint8_t)c);
+            puts(tmp);
+        }
+        else
+        {
+            put(c);
+        }
+    }
+    put('"');
+    return *this;
+}
+
+JsonWriter &JsonWriter::num(uint32_t v)
+{
+    char tmp[11];
+    snprintf(tmp, sizeof(tmp), "%lu", (unsigned long)v);
+    return raw(tmp);
+}
+
+JsonWriter &JsonWriter::numSigned(int32_t v)
+{
+    char tmp[12];
+    snprintf(tmp, sizeof(tmp), "%ld", (long)v);
+    return raw(tmp);
+}
+
+JsonWriter &JsonWriter::boolean(bool v)
+{
+    return raw(v ? "true" : "false");
+}
+
+JsonWriter &JsonWriter::null()
+{
+    return raw("null");
+}
+
+JsonWriter &JsonWriter::raw(const char *json)
+{
+    separate();
+    puts(json);
+    return *this;
+}
+
+size_t JsonWriter::finish()
+{
+    if (sink)
+    {
+        if (failed || !drain())
+        {
+            failed = true;
+            return 0;
+        }
+        return total;
+    }
+    if (failed)
+    {
+        if (cap)
+            buf[0] = '\0';
+        return 0;
+    }
+    buf[len] = '\0';
+    return len;
+}
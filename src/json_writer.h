@@ -0,0 +1,62 @@
+// json_writer.h
+// Allocation-free JSON writer. Output goes into a caller-provided buffer;
+// with a sink attached, a full buffer is handed to the sink (e.g. as one HTTP
+// chunk) and reused, so documents of any size stream through a small stack
+// buffer. Commas between members are inserted automatically.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+class JsonWriter
+{
+public:
+    // Receives each full buffer (and the tail on flush()). Return false to
+    // abort; the writer then fails like on overflow.
+    typedef bool (*Sink)(void *ctx, const char *data, size_t len);
+
+    JsonWriter(char *buf, size_t cap, Sink sink = nullptr, void *ctx = nullptr);
+
+    JsonWriter &beginObject();
+    JsonWriter &endObject();
+    JsonWriter &beginArray();
+    JsonWriter &endArray();
+    // Object member name; the next value call supplies its value.
+    JsonWriter &key(const char *name);
+
+    // Quoted, escaped string ("  \  and control characters).
+    JsonWriter &str(const char *s);
+    JsonWriter &num(uint32_t v);
+    JsonWriter &numSigned(int32_t v);
+    JsonWriter &boolean(bool v);
+    // Pre-formatted JSON value, written verbatim.
+    JsonWriter &raw(const char *json);
+    JsonWriter &null();
+
+    // Buffer mode: NUL-terminates and returns the length, or 0 on overflow.
+    // Sink mode: passes the remaining bytes to the sink and returns the total
+    // length written, or 0 if the sink failed.
+    size_t finish();
+    bool ok() const { return !failed; }
+
+private:
+    static const uint8_t MAX_DEPTH = 31;
+
+    void put(char c);
+    void puts(const char *s);
+    void separate();
+    void open(char c);
+    void close(char c);
+    bool drain();
+
+    char *buf;
+    size_t cap;
+    size_t len;
+    size_t total; // bytes already handed to the sink
+    Sink sink;
+    void *ctx;
+    bool failed;
+    bool afterKey;    // a key was written; the next value must not get a comma
+    uint8_t depth;
+    uint32_t hasItem; // bit n: container at depth n already has a member
+};
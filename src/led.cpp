@@ -13,8 +13,8 @@ static const uint8_t LED_ON_BRIGHTNESS = 3;
 static Adafruit_NeoPixel *neoPixel = nullptr;
 static bool neopixelAvailable = false;
 static bool pwmAttached = false;
-static unsigned long lastMs = 0;
 static bool stateOn = false;
+static bool holdShown = false;
 
 static uint8_t scale(uint8_t v)
 {
@@ -129,11 +129,38 @@ void ledFactoryResetVisual()
     }
 }
 
+void ledShowHold(bool apArmed)
+{
+    holdShown = true;
+    if (neopixelAvailable && neoPixel)
+    {
+        uint32_t c = apArmed ? neoPixel->Color(scale(0), scale(0), scale(255))
+                             : neoPixel->Color(scale(255), scale(191), scale(0));
+        neoPixel->setPixelColor(0, c);
+        neoPixel->show();
+    }
+    else if (pwmAttached)
+    {
+        ledcWrite(LEDC_CHANNEL, LED_ON_BRIGHTNESS);
+    }
+    else
+    {
+        digitalWrite(LED_PIN, HIGH);
+    }
+}
+
+void ledEndHold()
+{
+    if (!holdShown)
+        return;
+    holdShown = false;
+    ledSetOff();
+}
+
 void ledLoop()
 {
-    if (millis() - lastMs < 750)
+    if (holdShown)
         return;
-    lastMs = millis();
     stateOn = !stateOn;
     if (stateOn)
     {
@@ -4,8 +4,14 @@
 #include <Arduino.h>
 
 void ledInit();
+// Toggle the alive blink; scheduled every LED_BLINK_MS (see main.cpp).
+static const uint32_t LED_BLINK_MS = 750;
 void ledLoop();
 void ledSetProvisioningColor();
 void ledSetStaColor();
 void ledSetOff();
 void ledFactoryResetVisual();
+// BOOT hold feedback: amber while releasing would cancel, blue once it
+// would request the AP. Overrides the alive blink until ledEndHold().
+void ledShowHold(bool apArmed);
+void ledEndHold();
@@ -0,0 +1,154 @@
+#include "logger.h"
+#include "json_writer.h"
+#include <Arduino.h>
+#include <stdarg.h>
+
+struct LogEntry
+{
+    uint32_t seq; // 0 = never written
+    uint32_t ms;
+    uint8_t level;
+    char msg[LOG_MSG_MAX];
+};
+
+static LogEntry ring[LOG_CAPACITY];
+static uint32_t nextSeq = 1;
+static uint32_t flushedSeq = 1; // next entry the Serial task will print
+static portMUX_TYPE ringMux = portMUX_INITIALIZER_UNLOCKED;
+static volatile uint8_t runtimeLevel = LOG_LEVEL_INFO;
+static TaskHandle_t flushTask = nullptr;
+
+static const char LEVEL_CHARS[] = "-EWID";
+
+void logSetLevel(uint8_t level)
+{
+    runtimeLevel = level > LOG_LEVEL_DEBUG ? LOG_LEVEL_DEBUG : level;
+}
+
+uint8_t logLevel() { return runtimeLevel; }
+
+bool logEnabled(LogLevel level)
+{
+    return level != LOG_LEVEL_NONE && level <= TB_LOG_LEVEL && level <= runtimeLevel;
+}
+
+void logWrite(LogLevel level, const char *fmt, ...)
+{
+    if (!logEnabled(level))
+        return;
+    // Format outside the lock; only the copy into the ring is serialized.
+    char msg[LOG_MSG_MAX];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(msg, sizeof(msg), fmt, ap);
+    va_end(ap);
+    uint32_t now = millis();
+
+    portENTER_CRITICAL(&ringMux);
+    LogEntry &e = ring[nextSeq % LOG_CAPACITY];
+    e.seq = nextSeq++;
+    e.ms = now;
+    e.level = level;
+    memcpy(e.msg, msg, sizeof(msg));
+    portEXIT_CRITICAL(&ringMux);
+
+    if (flushTask)
+        xTaskNotifyGive(flushTask);
+}
+
+uint32_t logNextSeq()
+{
+    portENTER_CRITICAL(&ringMux);
+    uint32_t seq = nextSeq;
+    portEXIT_CRITICAL(&ringMux);
+    return seq;
+}
+
+// Copy entry `seq` out of the ring. False if it was overwritten or not yet
+// written.
+static bool readEntry(uint32_t seq, LogEntry &out)
+{
+    portENTER_CRITICAL(&ringMux);
+    const LogEntry &e = ring[seq % LOG_CAPACITY];
+    bool ok = e.seq == seq;
+    if (ok)
+        out = e;
+    portEXIT_CRITICAL(&ringMux);
+    return ok;
+}
+
+// Drains new entries to Serial. UART time is spent here, at idle+1
+// priority, instead of in whoever logged.
+static void flushTaskMain(void *)
+{
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(500));
+        uint32_t end = logNextSeq();
+        while (flushedSeq < end)
+        {
+            LogEntry e;
+            char line[LOG_MSG_MAX + 24];
+            if (!readEntry(flushedSeq, e))
+            {
+                // Overwritten before we got to it; skip to the oldest live entry.
+                uint32_t oldest = end > LOG_CAPACITY ? end - LOG_CAPACITY : 1;
+                uint32_t lost = oldest > flushedSeq ? oldest - flushedSeq : 1;
+                int n = snprintf(line, sizeof(line), "[log] %lu entries dropped\n", (unsigned long)lost);
+                Serial.write((const uint8_t *)line, n);
+                flushedSeq += lost;
+                continue;
+            }
+            int n = snprintf(line, sizeof(line), "[%6lu.%03lu] %c %s\n", (unsigned long)(e.ms / 1000),
+                             (unsigned long)(e.ms % 1000), LEVEL_CHARS[e.level], e.msg);
+            if (n >= (int)sizeof(line))
+                n = sizeof(line) - 1;
+            Serial.write((const uint8_t *)line, n);
+            ++flushedSeq;
+        }
+    }
+}
+
+void logInit()
+{
+    if (flushTask)
+        return;
+    xTaskCreate(flushTaskMain, "log_flush", 3072, nullptr, tskIDLE_PRIORITY + 1, &flushTask);
+}
+
+void logWriteJson(JsonWriter &w, uint32_t since)
+{
+    uint32_t end = logNextSeq();
+    uint32_t oldest = end > LOG_CAPACITY ? end - LOG_CAPACITY : 1;
+    if (since == 0)
+        since = 1;
+    uint32_t dropped = 0;
+    if (since < oldest)
+    {
+        dropped = oldest - since;
+        since = oldest;
+    }
+
+    w.beginObject();
+    w.key("next").num(end);
+    w.key("entries").beginArray();
+    for (uint32_t seq = since; seq < end; ++seq)
+    {
+        LogEntry e;
+        if (!readEntry(seq, e))
+        {
+            ++dropped; // overwritten while we were streaming
+            continue;
+        }
+        char level[2] = {LEVEL_CHARS[e.level], '\0'};
+        w.beginObject();
+        w.key("seq").num(e.seq);
+        w.key("ms").num(e.ms);
+        w.key("level").str(level);
+        w.key("msg").str(e.msg);
+        w.endObject();
+    }
+    w.endArray();
+    w.key("dropped").num(dropped);
+    w.endObject();
+}
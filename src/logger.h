@@ -0,0 +1,62 @@
+// logger.h
+// Level-gated logging into a fixed in-RAM ring. LOG_x() formats into the ring
+// and returns; a low-priority task drains new entries to Serial, so request
+// handlers never block on the UART. Recent entries are also served by
+// GET /logs?since=<seq>.
+//
+// Levels are gated twice: at compile time by TB_LOG_LEVEL (calls above it
+// compile out entirely; set with e.g. -DTB_LOG_LEVEL=4 in build_flags) and at
+// runtime by logSetLevel(), driven by the log_level config field.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+class JsonWriter;
+
+enum LogLevel : uint8_t
+{
+    LOG_LEVEL_NONE = 0,
+    LOG_LEVEL_ERROR = 1,
+    LOG_LEVEL_WARN = 2,
+    LOG_LEVEL_INFO = 3,
+    LOG_LEVEL_DEBUG = 4,
+};
+
+// Debug calls are compiled in by default so they can be enabled at runtime.
+#ifndef TB_LOG_LEVEL
+#define TB_LOG_LEVEL LOG_LEVEL_DEBUG
+#endif
+
+#define LOG_AT(level, ...)                            \
+    do                                                \
+    {                                                 \
+        if (TB_LOG_LEVEL >= (level))                  \
+            logWrite((LogLevel)(level), __VA_ARGS__); \
+    } while (0)
+#define LOG_E(...) LOG_AT(LOG_LEVEL_ERROR, __VA_ARGS__)
+#define LOG_W(...) LOG_AT(LOG_LEVEL_WARN, __VA_ARGS__)
+#define LOG_I(...) LOG_AT(LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_D(...) LOG_AT(LOG_LEVEL_DEBUG, __VA_ARGS__)
+
+// Ring geometry: LOG_CAPACITY entries of up to LOG_MSG_MAX - 1 characters
+// (longer messages are truncated).
+static const size_t LOG_CAPACITY = 64;
+static const size_t LOG_MSG_MAX = 96;
+
+// Start the Serial flush task. Entries logged before this are kept and
+// flushed once it runs.
+void logInit();
+void logSetLevel(uint8_t level);
+uint8_t logLevel();
+// True when a message at `level` would be recorded; use it to skip building
+// expensive log arguments (e.g. header dumps).
+bool logEnabled(LogLevel level);
+// Record one entry (printf-style). Safe from any task, not from ISRs.
+void logWrite(LogLevel level, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+// Sequence number the next entry will get; entries are numbered from 1.
+uint32_t logNextSeq();
+// {"next":<seq>,"entries":[{"seq","ms","level","msg"},...],"dropped":<n>}
+// for entries with seq >= since still in the ring, oldest first. "dropped"
+// counts requested entries already overwritten.
+void logWriteJson(JsonWriter &w, uint32_t since);
@@ -8,51 +8,86 @@
 #include "globals.h"
 #include "led.h"
 #include "system.h"
+#include "button.h"
 #include "init.h"
 #include "display.h"
+#include "metrics.h"
+#include "telemetry.h"
+#include "wifi_link.h"
+#include "scheduler.h"
+#include "sensors.h"
+#include "cores.h"
+#include "serial_console.h"
 
 // State objects
 // State objects are declared in `globals.h` and defined in `globals.cpp`
 
+
+static void otaTask()
+{
+    ArduinoOTA.handle();
+}
+
+// Periods are what each subsystem needs, not how fast a loop can spin; the
+// schedulers sleep in between. Order is priority within one pass. See
+// cores.h for why each task is on its side.
+static void registerTasks()
+{
+    schedAdd(SchedDomain::Ui, "ui", displayLoop, 20);
+    schedAdd(SchedDomain::Ui, "button", buttonTask, BUTTON_POLL_MS);
+    schedAdd(SchedDomain::Ui, "sensors", sensorsTask, 0); // woken by sensorsRequestReading()
+    schedAdd(SchedDomain::Ui, "ui_config", applyUiConfigChanges, 100);
+    schedAdd(SchedDomain::Ui, "led", ledLoop, LED_BLINK_MS);
+
+    schedAdd(SchedDomain::Net, "provisioning", loopProvisioning, 5); // fallback when its task failed to start
+    schedAdd(SchedDomain::Net, "wifi_link", wifiLinkLoop, 100);      // also woken by Wi-Fi events
+    schedAdd(SchedDomain::Net, "ota", otaTask, 50);
+    schedAdd(SchedDomain::Net, "net_config", applyNetConfigChanges, 100);
+    schedAdd(SchedDomain::Net, "telemetry", telemetryLoop, 100);
+    schedAdd(SchedDomain::Net, "system", systemLoop, 100);
+    schedAdd(SchedDomain::Net, "serial", serialConsoleTask, 50);
+}
+
+static void netTaskMain(void *)
+{
+    for (;;)
+        schedRun(SchedDomain::Net);
+}
+
+// Started once setup() has brought the network services up, so nothing on
+// the net core races their initialization.
+static void startNetTask()
+{
+    if (xTaskCreatePinnedToCore(netTaskMain, "net", NET_TASK_STACK, nullptr, 1, nullptr, NET_CORE) != pdPASS)
+        Serial.println("Net task failed to start; network services are not serviced");
+}
+
 void setup()
 {
+    registerTasks();
+
     // Lightweight setup delegating heavy work to init helpers
     initSerial();
+    bootMark("serial up");
     initPins();
     initLedAndSystem();
 
-    // Mount filesystem (attempt format if needed)
-    if (!initFileSystem())
+    // Load config (NVS fast path, else mount LittleFS and parse JSON); if not
+    // present this starts provisioning instead. The filesystem is mounted
+    // later, off the critical path, when the fast path hits.
+    if (tryLoadConfig())
     {
-        // Filesystem unavailable; fall back to provisioning
-        startProvisioning();
-        return;
+        bootMark("config loaded");
+        // Try to connect to configured WiFi. If that fails the link
+        // supervisor keeps retrying in the background (see wifi_link.h).
+        tryConnectWifi(15000);
     }
-
-    // Load config; if not present this will start provisioning and return false
-    if (!tryLoadConfig())
-        return;
-
-    // Try to connect to configured WiFi. If connection fails, provisioning is started.
-    tryConnectWifi(15000);
+    startNetTask();
+    bootMark("setup done");
 }
 
 void loop()
 {
-    if (isProvisioningActive())
-        loopProvisioning();
-
-    if (checkFactoryReset())
-        return;
-
-    loopStatusServer();
-
-    ArduinoOTA.handle();
-
-    displayLoop();
-
-    if (encoder)
-        encoder->update();
-
-    ledLoop();
+    metricsLoopTick();
+    schedRun(SchedDomain::Ui);
 }
@@ -0,0 +1,282 @@
+#include "metrics.h"
+#include "scheduler.h"
+#include <Arduino.h>
+#include <WiFi.h>
+#include <atomic>
+#include <stdarg.h>
+
+// Shared histogram bucket upper bounds in microseconds (100 us .. 1 s); one
+// more bucket catches everything above.
+static const uint32_t BUCKET_US[] = {100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000};
+static const size_t BUCKET_COUNT = sizeof(BUCKET_US) / sizeof(BUCKET_US[0]);
+
+// Latency histogram. Bucket counts are relaxed atomic increments. The 64-bit
+// microsecond sum is split into two words behind a sequence counter (a
+// seqlock), so a scrape never sees a torn value; this assumes one writer task
+// per histogram, which holds for every instance below.
+class Histogram
+{
+public:
+    void observe(uint32_t us)
+    {
+        size_t i = 0;
+        while (i < BUCKET_COUNT && us > BUCKET_US[i])
+            ++i;
+        counts[i].fetch_add(1, std::memory_order_relaxed);
+
+        uint32_t s = seq.load(std::memory_order_relaxed);
+        seq.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        uint32_t lo = sumLo.load(std::memory_order_relaxed);
+        uint32_t next = lo + us;
+        sumLo.store(next, std::memory_order_relaxed);
+        if (next < lo)
+            sumHi.store(sumHi.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        seq.store(s + 2, std::memory_order_release);
+    }
+
+    uint32_t count(size_t bucket) const { return counts[bucket].load(std::memory_order_relaxed); }
+
+    uint64_t sumMicros() const
+    {
+        for (;;)
+        {
+            uint32_t s1 = seq.load(std::memory_order_acquire);
+            uint32_t lo = sumLo.load(std::memory_order_relaxed);
+            uint32_t hi = sumHi.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (!(s1 & 1) && seq.load(std::memory_order_relaxed) == s1)
+                return ((uint64_t)hi << 32) | lo;
+        }
+    }
+
+private:
+    std::atomic<uint32_t> counts[BUCKET_COUNT + 1] = {};
+    std::atomic<uint32_t> seq{0};
+    std::atomic<uint32_t> sumLo{0};
+    std::atomic<uint32_t> sumHi{0};
+};
+
+static Histogram requestHist[MET_EP_COUNT];
+static Histogram i2cHist[MET_I2C_COUNT];
+static Histogram loopHist;
+static Histogram displayLatencyHist;
+static std::atomic<uint32_t> fsOps[MET_FS_COUNT];
+static std::atomic<uint32_t> displayFrames[MET_FRAME_COUNT];
+static std::atomic<uint32_t> displayBytes{0};
+static std::atomic<uint32_t> wifiConnects{0};
+static std::atomic<uint32_t> wifiDisconnects{0};
+static uint32_t lastLoopMicros = 0;
+
+// Label selectors, indexed by MetricEndpoint / MetricI2cDevice.
+static const char *const ENDPOINT_LABELS[MET_EP_COUNT] = {
+    "method=\"GET\",path=\"/status\"",  "method=\"GET\",path=\"/health\"",
+    "method=\"GET\",path=\"/config\"",  "method=\"PATCH\",path=\"/config\"",
+    "method=\"HEAD\",path=\"/config\"", "method=\"GET\",path=\"/logs\"",
+    "method=\"GET\",path=\"/files\"",   "method=\"HEAD\",path=\"/files\"",
+    "method=\"GET\",path=\"/metrics\"", "method=\"GET\",path=\"/events\"",
+    "method=\"GET\",path=\"/profile\"",
+};
+static const char *const I2C_LABELS[MET_I2C_COUNT] = {
+    "device=\"display\"",
+    "device=\"aht20\"",
+    "device=\"bmp280\"",
+};
+static const char *const FS_LABELS[MET_FS_COUNT] = {"open", "read", "write", "remove"};
+static const char *const FRAME_LABELS[MET_FRAME_COUNT] = {"full", "partial", "unchanged", "dropped"};
+
+void metricsInit()
+{
+    WiFi.onEvent([](WiFiEvent_t, WiFiEventInfo_t)
+                 { wifiConnects.fetch_add(1, std::memory_order_relaxed); },
+                 ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    WiFi.onEvent([](WiFiEvent_t, WiFiEventInfo_t)
+                 { wifiDisconnects.fetch_add(1, std::memory_order_relaxed); },
+                 ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+}
+
+void metricsLoopTick()
+{
+    uint32_t now = micros();
+    if (lastLoopMicros)
+        loopHist.observe(now - lastLoopMicros);
+    lastLoopMicros = now;
+}
+
+void metricsObserveRequest(MetricEndpoint ep, uint32_t us)
+{
+    if (ep < MET_EP_COUNT)
+        requestHist[ep].observe(us);
+}
+
+void metricsObserveI2c(MetricI2cDevice dev, uint32_t us)
+{
+    if (dev < MET_I2C_COUNT)
+        i2cHist[dev].observe(us);
+}
+
+void metricsCountFs(MetricFsOp op)
+{
+    if (op < MET_FS_COUNT)
+        fsOps[op].fetch_add(1, std::memory_order_relaxed);
+}
+
+void metricsObserveDisplayLatency(uint32_t us)
+{
+    displayLatencyHist.observe(us);
+}
+
+void metricsCountDisplayFrame(MetricDisplayFrame kind, uint32_t bytes)
+{
+    if (kind < MET_FRAME_COUNT)
+        displayFrames[kind].fetch_add(1, std::memory_order_relaxed);
+    displayBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+// ---- exposition ----
+
+// Buffers formatted lines and hands full buffers to the sink.
+class TextOut
+{
+public:
+    TextOut(MetricsSink sink, void *ctx) : sink(sink), ctx(ctx), len(0), ok(true) {}
+
+    void printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)))
+    {
+        char line[160];
+        va_list ap;
+        va_start(ap, fmt);
+        int n = vsnprintf(line, sizeof(line), fmt, ap);
+        va_end(ap);
+        if (n < 0)
+            return;
+        if ((size_t)n >= sizeof(line))
+            n = sizeof(line) - 1;
+        if (len + n > sizeof(buf))
+            flush();
+        memcpy(buf + len, line, n);
+        len += n;
+    }
+
+    bool flush()
+    {
+        if (ok && len)
+            ok = sink(ctx, buf, len);
+        len = 0;
+        return ok;
+    }
+
+private:
+    MetricsSink sink;
+    void *ctx;
+    char buf[512];
+    size_t len;
+    bool ok;
+};
+
+static void writeHeader(TextOut &out, const char *name, const char *type, const char *help)
+{
+    out.printf("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+// One series of a histogram; labels is a label selector without braces, or
+// "" (the header is written by the caller).
+static void writeHistogram(TextOut &out, const char *name, const char *labels, const Histogram &h)
+{
+    const char *sep = labels[0] ? "," : "";
+    uint32_t cumulative = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i)
+    {
+        cumulative += h.count(i);
+        out.printf("%s_bucket{%s%sle=\"%lu.%06lu\"} %lu\n", name, labels, sep, (unsigned long)(BUCKET_US[i] / 1000000),
+                   (unsigned long)(BUCKET_US[i] % 1000000), (unsigned long)cumulative);
+    }
+    cumulative += h.count(BUCKET_COUNT);
+    out.printf("%s_bucket{%s%sle=\"+Inf\"} %lu\n", name, labels, sep, (unsigned long)cumulative);
+    // A bare name rather than "name{}" when there are no labels.
+    const char *open = labels[0] ? "{" : "";
+    const char *close = labels[0] ? "}" : "";
+    uint64_t sum = h.sumMicros();
+    out.printf("%s_sum%s%s%s %lu.%06lu\n", name, open, labels, close, (unsigned long)(sum / 1000000),
+               (unsigned long)(sum % 1000000));
+    out.printf("%s_count%s%s%s %lu\n", name, open, labels, close, (unsigned long)cumulative);
+}
+
+bool metricsWrite(MetricsSink sink, void *ctx)
+{
+    TextOut out(sink, ctx);
+
+    writeHeader(out, "thermabridge_uptime_seconds", "gauge", "Seconds since boot.");
+    out.printf("thermabridge_uptime_seconds %lu\n", (unsigned long)(millis() / 1000UL));
+
+    const char *req = "thermabridge_http_request_duration_seconds";
+    writeHeader(out, req, "histogram", "STA HTTP handler latency by endpoint; _count is the request count.");
+    for (size_t i = 0; i < MET_EP_COUNT; ++i)
+        writeHistogram(out, req, ENDPOINT_LABELS[i], requestHist[i]);
+
+    const char *loopName = "thermabridge_loop_duration_seconds";
+    writeHeader(out, loopName, "histogram", "Time between successive loop() passes (scheduler wake-ups).");
+    writeHistogram(out, loopName, "", loopHist);
+
+    // Scheduler tasks; see scheduler.h for what counts as an overrun.
+    SchedTaskStats task;
+    writeHeader(out, "thermabridge_task_runs_total", "counter", "Scheduler task runs.");
+    for (size_t i = 0; schedTaskStats(i, task); ++i)
+        out.printf("thermabridge_task_runs_total{task=\"%s\"} %lu\n", task.name, (unsigned long)task.runs);
+    writeHeader(out, "thermabridge_task_overruns_total", "counter", "Task runs that finished past their deadline.");
+    for (size_t i = 0; schedTaskStats(i, task); ++i)
+        out.printf("thermabridge_task_overruns_total{task=\"%s\"} %lu\n", task.name, (unsigned long)task.overruns);
+    writeHeader(out, "thermabridge_task_run_seconds_total", "counter", "Time spent running each task.");
+    for (size_t i = 0; schedTaskStats(i, task); ++i)
+        out.printf("thermabridge_task_run_seconds_total{task=\"%s\"} %lu.%06lu\n", task.name,
+                   (unsigned long)(task.totalRunUs / 1000000), (unsigned long)(task.totalRunUs % 1000000));
+    writeHeader(out, "thermabridge_task_max_run_seconds", "gauge", "Longest single run of each task.");
+    for (size_t i = 0; schedTaskStats(i, task); ++i)
+        out.printf("thermabridge_task_max_run_seconds{task=\"%s\"} %lu.%06lu\n", task.name,
+                   (unsigned long)(task.maxRunUs / 1000000), (unsigned long)(task.maxRunUs % 1000000));
+    writeHeader(out, "thermabridge_task_max_lateness_seconds", "gauge", "Worst delay from release to start.");
+    for (size_t i = 0; schedTaskStats(i, task); ++i)
+        out.printf("thermabridge_task_max_lateness_seconds{task=\"%s\"} %lu.%06lu\n", task.name,
+                   (unsigned long)(task.maxLateUs / 1000000), (unsigned long)(task.maxLateUs % 1000000));
+
+    writeHeader(out, "thermabridge_heap_free_bytes", "gauge", "Current free heap.");
+    out.printf("thermabridge_heap_free_bytes %lu\n", (unsigned long)ESP.getFreeHeap());
+    writeHeader(out, "thermabridge_heap_min_free_bytes", "gauge", "Lowest free heap since boot.");
+    out.printf("thermabridge_heap_min_free_bytes %lu\n", (unsigned long)ESP.getMinFreeHeap());
+    writeHeader(out, "thermabridge_heap_max_alloc_bytes", "gauge", "Largest allocatable heap block.");
+    out.printf("thermabridge_heap_max_alloc_bytes %lu\n", (unsigned long)ESP.getMaxAllocHeap());
+
+    if (WiFi.status() == WL_CONNECTED)
+    {
+        writeHeader(out, "thermabridge_wifi_rssi_dbm", "gauge", "Station RSSI.");
+        out.printf("thermabridge_wifi_rssi_dbm %d\n", (int)WiFi.RSSI());
+    }
+    uint32_t connects = wifiConnects.load(std::memory_order_relaxed);
+    writeHeader(out, "thermabridge_wifi_reconnects_total", "counter", "Station connections after the first.");
+    out.printf("thermabridge_wifi_reconnects_total %lu\n", (unsigned long)(connects ? connects - 1 : 0));
+    writeHeader(out, "thermabridge_wifi_disconnects_total", "counter", "Station disconnect events.");
+    out.printf("thermabridge_wifi_disconnects_total %lu\n",
+               (unsigned long)wifiDisconnects.load(std::memory_order_relaxed));
+
+    const char *i2c = "thermabridge_i2c_duration_seconds";
+    writeHeader(out, i2c, "histogram", "I2C transaction latency by device.");
+    for (size_t i = 0; i < MET_I2C_COUNT; ++i)
+        writeHistogram(out, i2c, I2C_LABELS[i], i2cHist[i]);
+
+    writeHeader(out, "thermabridge_display_frames_total", "counter", "Display flushes by how they went out.");
+    for (size_t i = 0; i < MET_FRAME_COUNT; ++i)
+        out.printf("thermabridge_display_frames_total{kind=\"%s\"} %lu\n", FRAME_LABELS[i],
+                   (unsigned long)displayFrames[i].load(std::memory_order_relaxed));
+    writeHeader(out, "thermabridge_display_bytes_total", "counter", "I2C bytes sent to the display.");
+    out.printf("thermabridge_display_bytes_total %lu\n", (unsigned long)displayBytes.load(std::memory_order_relaxed));
+    const char *latency = "thermabridge_display_latency_seconds";
+    writeHeader(out, latency, "histogram", "Display frame handoff to end of its I2C transfer.");
+    writeHistogram(out, latency, "", displayLatencyHist);
+
+    writeHeader(out, "thermabridge_fs_ops_total", "counter", "LittleFS operations by kind.");
+    for (size_t i = 0; i < MET_FS_COUNT; ++i)
+        out.printf("thermabridge_fs_ops_total{op=\"%s\"} %lu\n", FS_LABELS[i],
+                   (unsigned long)fsOps[i].load(std::memory_order_relaxed));
+
+    return out.flush();
+}
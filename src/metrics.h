@@ -0,0 +1,74 @@
+// metrics.h
+// Fleet metrics exported by GET /metrics in the Prometheus text exposition
+// format. Recording is lock-free (relaxed atomic increments, no heap, no
+// locks) so it stays enabled in production builds; formatting only happens
+// when /metrics is scraped.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// STA server endpoints with their own request-latency histogram.
+enum MetricEndpoint : uint8_t
+{
+    MET_EP_STATUS,
+    MET_EP_HEALTH,
+    MET_EP_CONFIG,
+    MET_EP_CONFIG_PATCH,
+    MET_EP_CONFIG_HEAD,
+    MET_EP_LOGS,
+    MET_EP_FILES,
+    MET_EP_FILES_HEAD,
+    MET_EP_METRICS,
+    MET_EP_EVENTS, // subscription setup only; the stream itself is not timed
+    MET_EP_PROFILE,
+    MET_EP_COUNT,
+};
+
+enum MetricI2cDevice : uint8_t
+{
+    MET_I2C_DISPLAY, // SSD1306 framebuffer flush
+    MET_I2C_AHT20,
+    MET_I2C_BMP280,
+    MET_I2C_COUNT,
+};
+
+// How a display flush went out (ssd1306_shadow.h).
+enum MetricDisplayFrame : uint8_t
+{
+    MET_FRAME_FULL,
+    MET_FRAME_PARTIAL, // only the changed page/column windows
+    MET_FRAME_UNCHANGED,
+    MET_FRAME_DROPPED, // replaced by a newer frame before it went out
+    MET_FRAME_COUNT,
+};
+
+enum MetricFsOp : uint8_t
+{
+    MET_FS_OPEN,
+    MET_FS_READ, // one per read call (block), not per byte
+    MET_FS_WRITE,
+    MET_FS_REMOVE,
+    MET_FS_COUNT,
+};
+
+// Hook Wi-Fi events for the reconnect counter. Call once from setup().
+void metricsInit();
+// Call at the top of every loop() pass; records the time since the last call.
+void metricsLoopTick();
+// Each histogram below has one writer task (the STA httpd task for requests,
+// the loop task for I2C, the display flush task for the display); see the
+// note on Histogram in metrics.cpp.
+void metricsObserveRequest(MetricEndpoint ep, uint32_t micros);
+void metricsObserveI2c(MetricI2cDevice dev, uint32_t micros);
+void metricsCountFs(MetricFsOp op);
+// bytes: I2C bytes the frame took on the wire.
+void metricsCountDisplayFrame(MetricDisplayFrame kind, uint32_t bytes);
+// Display flush task only: time from handing a frame over to the end of its
+// transfer.
+void metricsObserveDisplayLatency(uint32_t micros);
+
+// Render all metrics, handing the text to sink in pieces (same contract as
+// JsonWriter::Sink). Returns false if the sink failed.
+typedef bool (*MetricsSink)(void *ctx, const char *data, size_t len);
+bool metricsWrite(MetricsSink sink, void *ctx);
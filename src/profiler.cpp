@@ -0,0 +1,193 @@
+#include "profiler.h"
+
+#if TB_PROFILE
+
+#include "json_writer.h"
+#include <Arduino.h>
+#include <string.h>
+
+struct Scope
+{
+    const char *group;
+    const char *name;
+    uint32_t count;
+    uint32_t minCycles;
+    uint32_t maxCycles;
+    uint64_t totalCycles;
+    uint32_t buckets[PROFILE_BUCKETS];
+};
+
+static Scope scopes[PROFILE_MAX_SCOPES];
+static size_t scopeCount = 0;
+// Guards the table; records from both cores and the readers all take it,
+// for a few dozen cycles at most.
+static portMUX_TYPE profileMux = portMUX_INITIALIZER_UNLOCKED;
+
+static void clearStats(Scope &s)
+{
+    s.count = 0;
+    s.minCycles = UINT32_MAX;
+    s.maxCycles = 0;
+    s.totalCycles = 0;
+    memset(s.buckets, 0, sizeof(s.buckets));
+}
+
+static size_t bucketOf(uint32_t cycles)
+{
+    int log2 = cycles ? 31 - __builtin_clz(cycles) : 0;
+    if (log2 < 9)
+        return 0;
+    size_t b = log2 - 8;
+    return b < PROFILE_BUCKETS ? b : PROFILE_BUCKETS - 1;
+}
+
+// Upper bound of bucket b in cycles (UINT32_MAX for the last one).
+static uint32_t bucketLimit(size_t b)
+{
+    return b + 1 < PROFILE_BUCKETS ? 1UL << (b + 9) : UINT32_MAX;
+}
+
+uint32_t profileCycles() { return ESP.getCycleCount(); }
+
+uint8_t profileRegister(const char *group, const char *name)
+{
+    uint8_t id = PROFILE_NO_SCOPE;
+    portENTER_CRITICAL(&profileMux);
+    for (size_t i = 0; i < scopeCount; ++i)
+    {
+        if (strcmp(scopes[i].group, group) == 0 && strcmp(scopes[i].name, name) == 0)
+        {
+            id = (uint8_t)i;
+            break;
+        }
+    }
+    if (id == PROFILE_NO_SCOPE && scopeCount < PROFILE_MAX_SCOPES)
+    {
+        Scope &s = scopes[scopeCount];
+        s.group = group;
+        s.name = name;
+        clearStats(s);
+        id = (uint8_t)scopeCount++;
+    }
+    portEXIT_CRITICAL(&profileMux);
+    return id;
+}
+
+void profileRecord(uint8_t scope, uint32_t cycles)
+{
+    if (scope >= PROFILE_MAX_SCOPES)
+        return;
+    size_t b = bucketOf(cycles);
+    portENTER_CRITICAL(&profileMux);
+    Scope &s = scopes[scope];
+    s.count++;
+    s.totalCycles += cycles;
+    if (cycles < s.minCycles)
+        s.minCycles = cycles;
+    if (cycles > s.maxCycles)
+        s.maxCycles = cycles;
+    s.buckets[b]++;
+    portEXIT_CRITICAL(&profileMux);
+}
+
+void profileReset()
+{
+    portENTER_CRITICAL(&profileMux);
+    for (size_t i = 0; i < scopeCount; ++i)
+        clearStats(scopes[i]);
+    portEXIT_CRITICAL(&profileMux);
+}
+
+// Consistent copy of one scope, so formatting runs outside the lock.
+static bool snapshot(size_t i, Scope &out)
+{
+    portENTER_CRITICAL(&profileMux);
+    bool ok = i < scopeCount;
+    if (ok)
+        out = scopes[i];
+    portEXIT_CRITICAL(&profileMux);
+    return ok;
+}
+
+// Cycles as microseconds with two decimals, e.g. "12.34".
+static void formatUs(char *buf, size_t cap, uint64_t cycles, uint32_t mhz)
+{
+    uint64_t centi = cycles * 100 / mhz;
+    snprintf(buf, cap, "%lu.%02lu", (unsigned long)(centi / 100), (unsigned long)(centi % 100));
+}
+
+void profileWriteJson(JsonWriter &w)
+{
+    uint32_t mhz = ESP.getCpuFreqMHz();
+    char num[24];
+    w.beginObject();
+    w.key("cpu_mhz").num(mhz);
+    w.key("scopes").beginArray();
+    Scope s;
+    for (size_t i = 0; snapshot(i, s); ++i)
+    {
+        w.beginObject();
+        w.key("group").str(s.group);
+        w.key("name").str(s.name);
+        w.key("count").num(s.count);
+        if (s.count)
+        {
+            formatUs(num, sizeof(num), s.minCycles, mhz);
+            w.key("min_us").raw(num);
+            formatUs(num, sizeof(num), s.totalCycles / s.count, mhz);
+            w.key("avg_us").raw(num);
+            formatUs(num, sizeof(num), s.maxCycles, mhz);
+            w.key("max_us").raw(num);
+            formatUs(num, sizeof(num), s.totalCycles, mhz);
+            w.key("total_us").raw(num);
+        }
+        // Non-empty buckets only, as [upper bound in us (null: open), count].
+        w.key("hist").beginArray();
+        for (size_t b = 0; b < PROFILE_BUCKETS; ++b)
+        {
+            if (!s.buckets[b])
+                continue;
+            w.beginArray();
+            if (b + 1 < PROFILE_BUCKETS)
+            {
+                formatUs(num, sizeof(num), bucketLimit(b), mhz);
+                w.raw(num);
+            }
+            else
+            {
+                w.null();
+            }
+            w.num(s.buckets[b]);
+            w.endArray();
+        }
+        w.endArray();
+        w.endObject();
+    }
+    w.endArray();
+    w.endObject();
+}
+
+void profilePrint(Print &out)
+{
+    uint32_t mhz = ESP.getCpuFreqMHz();
+    char mn[16], avg[16], mx[16], total[24];
+    out.printf("%-10s %-22s %8s %10s %10s %10s %12s  (us, %lu MHz)\n", "group", "name", "count", "min", "avg",
+               "max", "total", (unsigned long)mhz);
+    Scope s;
+    for (size_t i = 0; snapshot(i, s); ++i)
+    {
+        if (!s.count)
+        {
+            out.printf("%-10s %-22s %8u\n", s.group, s.name, 0U);
+            continue;
+        }
+        formatUs(mn, sizeof(mn), s.minCycles, mhz);
+        formatUs(avg, sizeof(avg), s.totalCycles / s.count, mhz);
+        formatUs(mx, sizeof(mx), s.maxCycles, mhz);
+        formatUs(total, sizeof(total), s.totalCycles, mhz);
+        out.printf("%-10s %-22s %8lu %10s %10s %10s %12s\n", s.group, s.name, (unsigned long)s.count, mn, avg, mx,
+                   total);
+    }
+}
+
+#endif // TB_PROFILE
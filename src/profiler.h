@@ -0,0 +1,80 @@
+// profiler.h
+// Scoped cycle-count profiler. A ProfileScope reads the CPU cycle counter on
+// entry and exit and adds the difference to its scope's count, min/avg/max
+// and a log2 histogram. Scopes cover every scheduler task, every STA HTTP
+// handler and the I2C transactions; results are served by GET /profile and
+// printed by the "profile" serial command, and both can reset them.
+//
+// The cycle counter is per core, so a scope must start and end on the same
+// core; every task that records one is pinned (see cores.h). Recording is a
+// few dozen cycles under a spinlock, so it is compiled in by default; build
+// with -DTB_PROFILE=0 to compile it out entirely.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef TB_PROFILE
+#define TB_PROFILE 1
+#endif
+
+class JsonWriter;
+class Print;
+
+// Scope table size, and the histogram: bucket 0 holds runs under 2^9 cycles
+// (~2 us at 240 MHz), bucket i runs of [2^(i+8), 2^(i+9)) cycles, and the
+// last one everything longer.
+static const size_t PROFILE_MAX_SCOPES = 40;
+static const size_t PROFILE_BUCKETS = 24;
+static const uint8_t PROFILE_NO_SCOPE = 0xFF;
+
+#if TB_PROFILE
+
+// Find or create the scope named group/name (both must be string literals
+// or otherwise outlive the program). Returns PROFILE_NO_SCOPE when the table
+// is full. Callable from any task.
+uint8_t profileRegister(const char *group, const char *name);
+void profileRecord(uint8_t scope, uint32_t cycles);
+void profileReset();
+// GET /profile body; streams through the writer's sink.
+void profileWriteJson(JsonWriter &w);
+// Human-readable table for the serial console.
+void profilePrint(Print &out);
+
+uint32_t profileCycles();
+
+class ProfileScope
+{
+public:
+    explicit ProfileScope(uint8_t scope) : scope(scope), start(profileCycles()) {}
+    ~ProfileScope() { profileRecord(scope, profileCycles() - start); }
+
+private:
+    uint8_t scope;
+    uint32_t start;
+};
+
+#define PROFILE_CONCAT2(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT2(a, b)
+// Profile the rest of the enclosing block as group/name.
+#define PROFILE_SCOPE(group, name)                                                          \
+    static const uint8_t PROFILE_CONCAT(profileId_, __LINE__) = profileRegister(group, name); \
+    ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(PROFILE_CONCAT(profileId_, __LINE__))
+
+#else
+
+inline uint8_t profileRegister(const char *, const char *) { return PROFILE_NO_SCOPE; }
+inline void profileReset() {}
+
+class ProfileScope
+{
+public:
+    explicit ProfileScope(uint8_t) {}
+};
+
+#define PROFILE_SCOPE(group, name) \
+    do                             \
+    {                              \
+    } while (0)
+
+#endif
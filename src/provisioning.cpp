@@ -1,21 +1,44 @@
 #include "provisioning.h"
 #include "config.h"
-#include "build_info.h"
+#include "status_api.h"
+#include "logger.h"
+#include "web_ui.h"
+#include "file_stream.h"
+#include "cores.h"
 #include <WiFi.h>
 #include <WebServer.h>
 #include <DNSServer.h>
 #include <LittleFS.h>
 #include <Preferences.h>
+#include <atomic>
 // Note: HTTP firmware upload endpoint removed (use ArduinoOTA instead)
 
 static WebServer server(80);
 static DNSServer dnsServer;
 static Preferences prefs;
-static bool provisioningActive = false;
-static WebServer statusServer(80);
-static bool statusServerActive = false;
+static std::atomic<bool> provisioningActive{false}; // read from both cores
+static TaskHandle_t provisioningTask = nullptr;
+// "http://<ap ip>/", the target of every captive-portal redirect.
+static char portalUrl[24] = "http://192.168.4.1/";
+
+enum class ConnectState : uint8_t
+{
+    Idle,
+    Pending, // waiting for a running scan to finish before WiFi.begin()
+    Connecting,
+    Connected,
+    Failed,
+};
+// Credential test started by /save; see connectTick().
+static ConnectState connectState = ConnectState::Idle;
 
 const byte DNS_PORT = 53;
+// Stack for the provisioning task; handleSave() keeps saveConfig()'s JSON
+// buffer on it.
+static const uint32_t PROVISIONING_STACK = 8192;
+
+// Request headers the server keeps for handlers; WebServer drops all others.
+static const char *COLLECTED_HEADERS[] = {"If-None-Match", "Accept-Encoding", "Range"};
 
 static String macSuffixHex()
 {
@@ -29,329 +52,461 @@ static String macSuffixHex()
 void handleNotFound()
 {
     // redirect any unknown path to root
-    server.sendHeader("Location", String("http://") + WiFi.softAPIP().toString(), true);
+    server.sendHeader("Location", portalUrl, true);
     server.send(302, "text/plain", "");
 }
 
-void handleSave()
+// Connectivity-check URLs probed by Android, iOS/macOS, Windows and Firefox
+// right after joining a network. Any answer other than the expected one
+// (204, "Success", ...) makes the OS open its sign-in window, so each gets an
+// immediate redirect to the portal instead of a trip through onNotFound.
+static const char *const CAPTIVE_PROBES[] = {
+    "/generate_204", "/gen_204",                          // Android, ChromeOS
+    "/hotspot-detect.html", "/library/test/success.html", // Apple
+    "/connecttest.txt", "/ncsi.txt", "/redirect",         // Windows
+    "/canonical.html", "/success.txt",                    // Firefox
+};
+
+static void handleCaptiveProbe()
 {
-    if (server.method() != HTTP_POST)
-    {
-        server.send(405, "text/plain", "Method Not Allowed");
-        return;
-    }
-    Config cfg;
-    cfg.ssid = server.arg("ssid");
-    cfg.psk = server.arg("psk");
-    cfg.devname = server.arg("devname");
-    // SECURITY CONSIDERATION: The OTA password is stored in plain text in the configuration file.
-    // Anyone with filesystem access can read this password. See README for details.
-    cfg.ota_password = server.arg("ota_password");
-    // Parse optional reset_hold_seconds (numeric). Default to 10 if missing or invalid.
-    String rhs = server.arg("reset_hold_seconds");
-    if (rhs.length() > 0)
-    {
-        int v = rhs.toInt();
-        if (v <= 0)
-            v = 10;
-        cfg.reset_hold_seconds = (uint16_t)v;
-    }
-    else
+    server.sendHeader("Location", portalUrl);
+    server.sendHeader("Cache-Control", "no-store");
+    server.send(302, "text/plain", "");
+}
+
+// ---- Wi-Fi scan cache (GET /scan) ----
+//
+// Scans run asynchronously on the provisioning task and the result is kept in
+// RAM, so /scan answers at once from the cache. Touched only by that task.
+
+static const uint8_t SCAN_MAX_RESULTS = 20;
+static const unsigned long SCAN_REFRESH_MS = 30000;
+// Minimum spacing between scan attempts (also after a failed one).
+static const unsigned long SCAN_RETRY_MS = 5000;
+// Background refreshes stop once the UI has not asked for this long: a scan
+// takes the AP off its channel for a moment.
+static const unsigned long SCAN_IDLE_MS = 120000;
+
+struct ScanEntry
+{
+    char ssid[33];
+    int8_t rssi;
+    uint8_t channel;
+    bool secure;
+};
+
+static ScanEntry scanResults[SCAN_MAX_RESULTS];
+static uint8_t scanCount = 0;
+static unsigned long scanFinishedAt = 0; // 0 until the first scan completes
+static unsigned long scanStartedAt = 0;
+static unsigned long lastScanRequest = 0;
+static bool scanRunning = false;
+
+// Copy n finished scan results into the cache: hidden networks dropped, one
+// entry per SSID (the strongest), strongest first.
+static void collectScan(int16_t n)
+{
+    ScanEntry found[SCAN_MAX_RESULTS];
+    uint8_t count = 0;
+    for (int16_t i = 0; i < n; ++i)
     {
-        cfg.reset_hold_seconds = 10;
+        String ssid = WiFi.SSID(i);
+        if (ssid.length() == 0 || ssid.length() >= sizeof(found[0].ssid))
+            continue;
+        int8_t rssi = (int8_t)WiFi.RSSI(i);
+        uint8_t slot = 0;
+        while (slot < count && strcmp(found[slot].ssid, ssid.c_str()) != 0)
+            ++slot;
+        if (slot == count)
+        {
+            if (count < SCAN_MAX_RESULTS)
+                ++count;
+            else if (rssi > found[count - 1].rssi)
+                slot = count - 1; // replace the weakest
+            else
+                continue;
+        }
+        else if (rssi <= found[slot].rssi)
+        {
+            continue;
+        }
+        ScanEntry &e = found[slot];
+        strlcpy(e.ssid, ssid.c_str(), sizeof(e.ssid));
+        e.rssi = rssi;
+        e.channel = (uint8_t)WiFi.channel(i);
+        e.secure = WiFi.encryptionType(i) != WIFI_AUTH_OPEN;
+        // Bubble the updated entry up to keep the list sorted by RSSI.
+        for (; slot > 0 && found[slot].rssi > found[slot - 1].rssi; --slot)
+        {
+            ScanEntry t = found[slot];
+            found[slot] = found[slot - 1];
+            found[slot - 1] = t;
+        }
     }
-    if (cfg.ssid.length() == 0)
+    memcpy(scanResults, found, count * sizeof(ScanEntry));
+    scanCount = count;
+}
+
+static void scanTick()
+{
+    unsigned long now = millis();
+    if (scanRunning)
     {
-        server.send(400, "text/plain", "SSID required");
+        int16_t n = WiFi.scanComplete();
+        if (n == WIFI_SCAN_RUNNING)
+            return;
+        scanRunning = false;
+        if (n >= 0)
+        {
+            collectScan(n);
+            scanFinishedAt = now;
+            LOG_D("Scan found %d networks (%u listed)", n, (unsigned)scanCount);
+        }
+        WiFi.scanDelete();
         return;
     }
+    if (connectState == ConnectState::Pending || connectState == ConnectState::Connecting)
+        return; // scanning would stall the credential test
+    bool stale = scanFinishedAt == 0 || now - scanFinishedAt >= SCAN_REFRESH_MS;
+    bool wanted = scanFinishedAt == 0 || now - lastScanRequest < SCAN_IDLE_MS;
+    if (!stale || !wanted || (scanStartedAt && now - scanStartedAt < SCAN_RETRY_MS))
+        return;
+    scanStartedAt = now;
+    scanRunning = WiFi.scanNetworks(true, false) == WIFI_SCAN_RUNNING;
+}
 
-    if (!saveConfig(cfg))
+// JsonWriter sink: one HTTP chunk per full buffer.
+static bool sendChunk(void *ctx, const char *data, size_t len)
+{
+    static_cast<WebServer *>(ctx)->sendContent(data, len);
+    return true;
+}
+
+// GET /scan: cached networks, strongest first. age_ms is null until the first
+// scan completes; the UI polls again while scanning is true.
+static void handleScan()
+{
+    unsigned long now = millis();
+    lastScanRequest = now;
+    server.sendHeader("Cache-Control", "no-store");
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "application/json", "");
+    char buf[256];
+    JsonWriter w(buf, sizeof(buf), sendChunk, &server);
+    w.beginObject();
+    w.key("age_ms");
+    if (scanFinishedAt)
+        w.num(now - scanFinishedAt);
+    else
+        w.null();
+    w.key("scanning").boolean(scanRunning);
+    w.key("networks").beginArray();
+    for (uint8_t i = 0; i < scanCount; ++i)
     {
-        server.send(500, "text/plain", "Failed to save config");
-        return;
+        const ScanEntry &e = scanResults[i];
+        w.beginObject();
+        w.key("ssid").str(e.ssid);
+        w.key("rssi").numSigned(e.rssi);
+        w.key("channel").num(e.channel);
+        w.key("secure").boolean(e.secure);
+        w.endObject();
     }
+    w.endArray();
+    w.endObject();
+    w.finish();
+    server.sendContent("", 0); // terminating chunk
+}
 
-    String rsp = "<html><body><h3>Saved. Attempting to connect to ";
-    rsp += cfg.ssid;
-    rsp += " ...</h3><p>If successful, the device will reboot.</p></body></html>";
-    server.send(200, "text/html", rsp);
+// ---- Credential test after /save ----
+//
+// handleSave() only stores the config and starts WiFi.begin() on the STA
+// side of AP+STA mode; connectTick() on the provisioning task follows the
+// attempt, so the portal keeps answering while it runs and the UI can poll
+// GET /save/status. On success the device restarts into STA mode after a
+// short delay that lets the UI show the result.
+
+static const unsigned long CONNECT_TIMEOUT_MS = 15000;
+static const unsigned long RESTART_DELAY_MS = 5000;
+
+static char connectSsid[sizeof(Config::ssid)] = "";
+static char connectPsk[sizeof(Config::psk)] = "";
+static unsigned long connectStartedAt = 0;
+static unsigned long connectFinishedAt = 0;
+static IPAddress connectIp;
+static uint8_t connectReason = 0; // wifi_err_reason_t of a failed attempt; 0 = timeout
+// Written by the Wi-Fi event task on each STA disconnect during an attempt.
+static std::atomic<uint8_t> lastDisconnectReason{0};
 
-    // Attempt connection
-    WiFi.disconnect();
-    WiFi.mode(WIFI_STA);
-    WiFi.begin(cfg.ssid.c_str(), cfg.psk.c_str());
+// Reasons that mean the credentials are wrong; retrying will not help.
+static bool isAuthFailure(uint8_t reason)
+{
+    return reason == 2 /* AUTH_EXPIRE */ || reason == 15 /* 4WAY_HANDSHAKE_TIMEOUT */ ||
+           reason == 202 /* AUTH_FAIL */ || reason == 204 /* HANDSHAKE_TIMEOUT */;
+}
 
-    unsigned long start = millis();
-    const unsigned long CONNECT_TIMEOUT = 15000; // 15s
-    while (millis() - start < CONNECT_TIMEOUT)
+static const char *reasonText(uint8_t reason)
+{
+    switch (reason)
     {
-        if (WiFi.status() == WL_CONNECTED)
-            break;
-        delay(200);
+    case 0:
+        return "timeout";
+    case 2:
+    case 15:
+    case 202:
+    case 204:
+        return "wrong password";
+    case 201:
+        return "network not found";
+    case 203:
+        return "association failed";
+    default:
+        return "disconnected";
     }
+}
+
+static void onStaDisconnected(WiFiEvent_t, WiFiEventInfo_t info)
+{
+    lastDisconnectReason.store(info.wifi_sta_disconnected.reason, std::memory_order_relaxed);
+}
 
-    if (WiFi.status() == WL_CONNECTED)
+static void connectTick()
+{
+    unsigned long now = millis();
+    switch (connectState)
     {
-        // connected successfully
-        Serial.println("Provisioning: connected to WiFi, rebooting...");
-        delay(1000);
-        ESP.restart();
-    }
-    else
+    case ConnectState::Pending:
+        if (scanRunning)
+            return;
+        lastDisconnectReason.store(0, std::memory_order_relaxed);
+        WiFi.disconnect(); // STA side only; the AP stays up
+        WiFi.begin(connectSsid, connectPsk);
+        connectStartedAt = now;
+        connectState = ConnectState::Connecting;
+        LOG_I("Provisioning: connecting to %s", connectSsid);
+        return;
+    case ConnectState::Connecting:
     {
-        Serial.println("Provisioning: failed to connect");
+        if (WiFi.status() == WL_CONNECTED)
+        {
+            connectIp = WiFi.localIP();
+            connectFinishedAt = now;
+            connectState = ConnectState::Connected;
+            LOG_I("Provisioning: connected to %s, restarting in %lu ms", connectSsid, RESTART_DELAY_MS);
+            return;
+        }
+        uint8_t reason = lastDisconnectReason.load(std::memory_order_relaxed);
+        if (!isAuthFailure(reason) && now - connectStartedAt < CONNECT_TIMEOUT_MS)
+            return;
+        WiFi.disconnect();
+        connectReason = reason;
+        connectFinishedAt = now;
+        connectState = ConnectState::Failed;
+        LOG_W("Provisioning: failed to connect to %s (%s, reason %u)", connectSsid, reasonText(reason),
+              (unsigned)reason);
+        return;
+    }
+    case ConnectState::Connected:
+        if (now - connectFinishedAt >= RESTART_DELAY_MS)
+        {
+            Serial.println("Provisioning: connected to WiFi, rebooting...");
+            ESP.restart();
+        }
+        return;
+    default:
+        return;
     }
 }
 
-void handleStatus()
+void handleSave()
 {
-    // Log incoming request for diagnostics
-    IPAddress remote = server.client().remoteIP();
-    Serial.print("/status request from: ");
-    Serial.println(remote.toString());
-    Serial.print("Method: ");
-    Serial.println(server.method() == HTTP_GET ? "GET" : "OTHER");
-    Serial.print("URI: ");
-    Serial.println(server.uri());
-    // Print all headers
-    int headers = server.headers();
-    Serial.print("Headers (count=");
-    Serial.print(headers);
-    Serial.println(")");
-    for (int i = 0; i < headers; ++i)
-    {
-        String name = server.headerName(i);
-        String value = server.header(i);
-        Serial.print("  ");
-        Serial.print(name);
-        Serial.print(": ");
-        Serial.println(value);
-    }
-    // Print query args
-    int args = server.args();
-    Serial.print("Args (count=");
-    Serial.print(args);
-    Serial.println(")");
-    for (int i = 0; i < args; ++i)
+    if (server.method() != HTTP_POST)
     {
-        Serial.print("  ");
-        Serial.print(server.argName(i));
-        Serial.print(" = ");
-        Serial.println(server.arg(i));
+        server.send(405, "text/plain", "Method Not Allowed");
+        return;
     }
-
-    // Return JSON with masked SSID/PSK and connection status
-    Config current;
-    bool has = loadConfig(current);
-
-    String json = "{";
-    json += "\"configured\":" + String(has ? "true" : "false") + ",";
-    if (has)
+    // Start from the current config so fields the form does not carry keep
+    // their values, then apply every posted field through the schema (type
+    // and range checks live in config_schema.h). An empty value restores the
+    // field default.
+    // SECURITY CONSIDERATION: The OTA password is stored in plain text in the configuration file.
+    // Anyone with filesystem access can read this password. See README for details.
+    Config cfg = configSnapshot()->cfg;
+    for (int i = 0; i < server.args(); ++i)
     {
-        // mask PSK for safety
-        String pskMasked = current.psk;
-        if (pskMasked.length() > 0)
+        String name = server.argName(i);
+        ConfigFieldStatus st = configSetField(cfg, name.c_str(), server.arg(i).c_str());
+        if (st == ConfigFieldStatus::UnknownField)
+            continue; // ignore non-config form fields
+        if (st != ConfigFieldStatus::Ok)
         {
-            for (size_t i = 0; i < pskMasked.length(); ++i)
-                pskMasked.setCharAt(i, '*');
+            server.send(400, "text/plain", "Invalid value for " + name);
+            return;
         }
-        // mask OTA password
-        String otaMasked = current.ota_password;
-        if (otaMasked.length() > 0)
-        {
-            for (size_t i = 0; i < otaMasked.length(); ++i)
-                otaMasked.setCharAt(i, '*');
-        }
-        json += "\"ssid\":\"" + current.ssid + "\",";
-        json += "\"psk_masked\":\"" + pskMasked + "\",";
-        json += "\"devname\":\"" + current.devname + "\",";
-        json += "\"ota_password_masked\":\"" + otaMasked + "\",";
     }
-    else
+    if (cfg.ssid[0] == '\0')
     {
-        json += "\"ssid\":\"\",";
-        json += "\"psk_masked\":\"\",";
-        json += "\"devname\":\"\",";
+        server.send(400, "text/plain", "SSID required");
+        return;
     }
-
-    int status = WiFi.status();
-    json += "\"wifi_status\":" + String(status) + ",";
-    if (status == WL_CONNECTED)
+    if (cfg.static_ip[0] && !cfg.static_gateway[0])
     {
-        json += "\"ip\":\"" + WiFi.localIP().toString() + "\"";
+        server.send(400, "text/plain", "Gateway required with a static IP");
+        return;
     }
-    else
+    if (connectState == ConnectState::Connected)
     {
-        json += "\"ip\":\"\"";
+        server.send(409, "text/plain", "Already connected; restarting");
+        return;
     }
-    json += "}";
 
-    // Append firmware version info to the status response under key "firmware_version"
-    // Insert before final closing brace by rebuilding the tail of the JSON.
-    if (json.length() > 0 && json.charAt(json.length() - 1) == '}')
+    if (!saveConfig(cfg))
     {
-        json = json.substring(0, json.length() - 1);
-        json += ",\"firmware_version\":\"" + String(FW_VERSION) + "\"}";
+        server.send(500, "text/plain", "Failed to save config");
+        return;
     }
 
-    server.send(200, "application/json", json);
+    // Test the credentials in the background; a new /save during an attempt
+    // restarts it with the new values.
+    strlcpy(connectSsid, cfg.ssid, sizeof(connectSsid));
+    strlcpy(connectPsk, cfg.psk, sizeof(connectPsk));
+    connectState = ConnectState::Pending;
+
+    String rsp = "<html><body><h3>Saved. Attempting to connect to ";
+    rsp += cfg.ssid;
+    rsp += " ...</h3><p>If successful, the device will reboot. Progress: <a href=\"/save/status\">/save/status</a></p></body></html>";
+    server.send(200, "text/html", rsp);
 }
 
-void handleHealth()
+// GET /save/status: progress of the credential test started by /save.
+static void handleSaveStatus()
 {
-    unsigned long upSec = millis() / 1000UL;
-    size_t freeHeap = ESP.getFreeHeap();
-    String json = "{";
-    json += "\"uptime_s\": " + String(upSec) + ",";
-    json += "\"free_heap\": " + String(freeHeap);
-    json += "}";
-    Serial.print("/health requested from: ");
-    Serial.println(server.client().remoteIP().toString());
-    server.send(200, "application/json", json);
+    static const char *const STATE_NAMES[] = {"idle", "connecting", "connecting", "connected", "failed"};
+    unsigned long now = millis();
+    // Keys and numbers fit in 128; the SSID may escape every byte as \u00XX.
+    char body[128 + 6 * (sizeof(Config::ssid) - 1)];
+    JsonWriter w(body, sizeof(body));
+    w.beginObject();
+    w.key("state").str(STATE_NAMES[(uint8_t)connectState]);
+    if (connectState != ConnectState::Idle)
+    {
+        w.key("ssid").str(connectSsid);
+        // Pending: the attempt has not started, and connectStartedAt still
+        // belongs to the previous one.
+        unsigned long elapsed = 0;
+        if (connectState == ConnectState::Connecting)
+            elapsed = now - connectStartedAt;
+        else if (connectState != ConnectState::Pending)
+            elapsed = connectFinishedAt - connectStartedAt;
+        w.key("elapsed_ms").num(elapsed);
+    }
+    if (connectState == ConnectState::Connected)
+    {
+        char ip[16];
+        snprintf(ip, sizeof(ip), "%u.%u.%u.%u", connectIp[0], connectIp[1], connectIp[2], connectIp[3]);
+        w.key("ip").str(ip);
+        unsigned long since = now - connectFinishedAt;
+        w.key("restart_in_ms").num(since < RESTART_DELAY_MS ? RESTART_DELAY_MS - since : 0);
+    }
+    else if (connectState == ConnectState::Failed)
+    {
+        w.key("reason").num(connectReason);
+        w.key("reason_text").str(reasonText(connectReason));
+    }
+    w.endObject();
+    size_t len = w.finish();
+    server.sendHeader("Cache-Control", "no-store");
+    server.send_P(200, "application/json", body, len);
 }
 
-// Helper to send the raw config.json file from LittleFS via the provided server
-static void sendConfigFile(WebServer &srv)
+// /status responder for the AP server. Reads the in-memory config snapshot
+// instead of the filesystem and answers 304 when the client's If-None-Match
+// still matches; payload and ETag come from status_api so they match the
+// STA server's.
+static void sendStatus(WebServer &srv, const char *label)
 {
-    if (!LittleFS.exists("/config.json"))
+    // One-line summary; the full header/arg dump only at debug level.
+    if (logEnabled(LOG_LEVEL_INFO))
+        LOG_I("%s from %s", label, srv.client().remoteIP().toString().c_str());
+    if (logEnabled(LOG_LEVEL_DEBUG))
     {
-        srv.send(404, "text/plain", "config.json not found");
-        return;
+        for (int i = 0; i < srv.headers(); ++i)
+            LOG_D("  %s: %s", srv.headerName(i).c_str(), srv.header(i).c_str());
+        for (int i = 0; i < srv.args(); ++i)
+            LOG_D("  arg %s = %s", srv.argName(i).c_str(), srv.arg(i).c_str());
     }
-    File f = LittleFS.open("/config.json", "r");
-    if (!f)
+
+    StatusView v = captureStatus();
+    char etag[48];
+    statusETag(v, etag, sizeof(etag));
+    srv.sendHeader("ETag", etag);
+    srv.sendHeader("Cache-Control", "no-cache");
+    if (srv.header("If-None-Match") == etag)
     {
-        srv.send(500, "text/plain", "failed to open config.json");
+        srv.send(304);
         return;
     }
-    String body;
-    while (f.available())
-        body += (char)f.read();
-    f.close();
-    srv.send(200, "application/json", body);
+
+    char body[STATUS_JSON_MAX];
+    JsonWriter w(body, sizeof(body));
+    writeStatusJson(w, v);
+    size_t len = w.finish();
+    srv.send_P(200, "application/json", body, len);
 }
 
-// AP-mode wrapper
-static void handleDownloadConfigAP()
+void handleStatus()
 {
-    sendConfigFile(server);
+    sendStatus(server, "/status");
 }
 
-// STA-mode wrapper
-static void handleDownloadConfigSTA()
+void handleHealth()
 {
-    sendConfigFile(statusServer);
+    if (logEnabled(LOG_LEVEL_INFO))
+        LOG_I("/health from %s", server.client().remoteIP().toString().c_str());
+    char body[HEALTH_JSON_MAX];
+    JsonWriter w(body, sizeof(body));
+    writeHealthJson(w);
+    size_t len = w.finish();
+    server.send_P(200, "application/json", body, len);
 }
 
-void startStatusServer()
+// GET /logs?since=<seq>: recent log entries, streamed in chunks.
+static void handleLogs()
 {
-    // Start a simple status server on port 80 that always responds when in STA mode.
-    statusServer.on("/status", HTTP_GET, []()
-                    {
-        // Log incoming request on the STA-mode status server
-        IPAddress remote = statusServer.client().remoteIP();
-        Serial.print("/status (STA) request from: ");
-        Serial.println(remote.toString());
-        // Note: statusServer is in lambda context; print method/URI and enumerate headers/args
-        Serial.println("Method: GET");
-        Serial.println("URI: /status");
-        int headers = statusServer.headers();
-        Serial.print("Headers (count="); Serial.print(headers); Serial.println(")");
-        for (int i = 0; i < headers; ++i) {
-            String name = statusServer.headerName(i);
-            String value = statusServer.header(i);
-            Serial.print("  "); Serial.print(name); Serial.print(": "); Serial.println(value);
-        }
-        int args = statusServer.args();
-        Serial.print("Args (count="); Serial.print(args); Serial.println(")");
-        for (int i = 0; i < args; ++i) {
-            Serial.print("  "); Serial.print(statusServer.argName(i)); Serial.print(" = "); Serial.println(statusServer.arg(i));
-        }
+    uint32_t since = strtoul(server.arg("since").c_str(), nullptr, 10);
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "application/json", "");
+    char buf[256];
+    JsonWriter w(buf, sizeof(buf), sendChunk, &server);
+    logWriteJson(w, since);
+    w.finish();
+    server.sendContent("", 0); // terminating chunk
+}
 
-        Config current;
-        bool has = loadConfig(current);
-        String json = "{";
-        json += "\"configured\":" + String(has ? "true" : "false") + ",";
-        if (has) {
-            String pskMasked = current.psk;
-            if (pskMasked.length() > 0) {
-                for (size_t i = 0; i < pskMasked.length(); ++i) pskMasked.setCharAt(i, '*');
-            }
-            String otaMasked = current.ota_password;
-            if (otaMasked.length() > 0) {
-                for (size_t i = 0; i < otaMasked.length(); ++i) otaMasked.setCharAt(i, '*');
-            }
-            json += "\"ssid\":\"" + current.ssid + "\",";
-            json += "\"psk_masked\":\"" + pskMasked + "\",";
-            json += "\"devname\":\"" + current.devname + "\",";
-            json += "\"ota_password_masked\":\"" + otaMasked + "\",";
-        } else {
-            json += "\"ssid\":\"\",";
-            json += "\"psk_masked\":\"\",";
-            json += "\"devname\":\"\",";
-        }
-        int status = WiFi.status();
-        json += "\"wifi_status\":" + String(status) + ",";
-        if (status == WL_CONNECTED) {
-            json += "\"ip\":\"" + WiFi.localIP().toString() + "\"";
-        } else {
-            json += "\"ip\":\"\"";
-        }
-        json += "}";
-        // add firmware_version to STA-mode response similarly
-        if (json.length() > 0 && json.charAt(json.length() - 1) == '}') {
-            json = json.substring(0, json.length() - 1);
-            json += ",\"firmware_version\":\"" + String(FW_VERSION) + "\"}";
-        }
-        statusServer.send(200, "application/json", json); });
-    // Expose the config file from STA-mode status server as well
-    statusServer.on("/config", HTTP_GET, []()
-                    {
-        Serial.print("/config (STA) requested from: ");
-        Serial.println(statusServer.client().remoteIP().toString());
-        // Use the shared helper to send the LittleFS config file
-        sendConfigFile(statusServer); });
-    statusServer.on("/config.json", HTTP_GET, []()
-                    {
-        Serial.print("/config.json (STA) requested from: ");
-        Serial.println(statusServer.client().remoteIP().toString());
-        sendConfigFile(statusServer); });
-    // Add /health to STA-mode status server
-    statusServer.on("/health", HTTP_GET, []()
-                    {
-        unsigned long upSec = millis() / 1000UL;
-        size_t freeHeap = ESP.getFreeHeap();
-        String json = "{";
-        json += "\"uptime_s\": " + String(upSec) + ",";
-        json += "\"free_heap\": " + String(freeHeap);
-        json += "}";
-        Serial.print("/health (STA) requested from: ");
-        Serial.println(statusServer.client().remoteIP().toString());
-        statusServer.send(200, "application/json", json); });
-    statusServer.begin();
-    // Mark the STA-mode status server as active so loopStatusServer() polls it
-    statusServerActive = true;
-    // Log any unmatched requests on the STA server for diagnostics
-    statusServer.onNotFound([]()
-                            {
-        IPAddress remote = statusServer.client().remoteIP();
-        Serial.print("STA notFound request from: ");
-        Serial.println(remote.toString());
-        Serial.print("URI: ");
-        Serial.println(statusServer.uri());
-        statusServer.send(404, "text/plain", "Not found"); });
+// GET/HEAD /config: the raw LittleFS config.json
+static void handleDownloadConfigAP()
+{
+    sendFile(server, "/config.json", "application/json");
 }
 
-void loopStatusServer()
+// Services DNS, HTTP and the background scan on its own task, so captive
+// portal probes are answered even while the net scheduler task is busy
+// (OTA, config changes) and independently of the UI core.
+static void provisioningTaskMain(void *)
 {
-    if (!statusServerActive)
-        return;
-    statusServer.handleClient();
+    for (;;)
+    {
+        dnsServer.processNextRequest();
+        server.handleClient();
+        scanTick();
+        connectTick();
+        vTaskDelay(pdMS_TO_TICKS(2));
+    }
 }
 
 void startProvisioning()
 {
+    if (provisioningActive)
+        return;
     if (!LittleFS.begin())
     {
         Serial.println("LittleFS mount failed");
@@ -362,35 +517,50 @@ void startProvisioning()
     Serial.print("Starting AP: ");
     Serial.println(apSSID);
 
-    WiFi.mode(WIFI_AP);
+    // AP+STA: the station interface is only used for /scan.
+    WiFi.mode(WIFI_AP_STA);
     WiFi.softAP(apSSID.c_str());
     IPAddress apIP = WiFi.softAPIP();
+    WiFi.onEvent(onStaDisconnected, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+    snprintf(portalUrl, sizeof(portalUrl), "http://%u.%u.%u.%u/", apIP[0], apIP[1], apIP[2], apIP[3]);
 
     dnsServer.start(DNS_PORT, "*", apIP);
 
     server.onNotFound(handleNotFound);
+    for (size_t i = 0; i < sizeof(CAPTIVE_PROBES) / sizeof(CAPTIVE_PROBES[0]); ++i)
+        server.on(CAPTIVE_PROBES[i], HTTP_GET, handleCaptiveProbe);
     server.on("/status", HTTP_GET, handleStatus);
-    server.serveStatic("/", LittleFS, "/index.html");
-    server.serveStatic("/app.js", LittleFS, "/app.js");
-    server.serveStatic("/style.css", LittleFS, "/style.css");
+    server.on("/scan", HTTP_GET, handleScan);
+    registerWebUi(server);
     server.on("/save", HTTP_POST, handleSave);
+    server.on("/save/status", HTTP_GET, handleSaveStatus);
     // Expose the config file under both /config and /config.json for compatibility
     server.on("/config", HTTP_GET, handleDownloadConfigAP);      // Route for AP mode
     server.on("/config.json", HTTP_GET, handleDownloadConfigAP); // Alias
-    // Also register handlers on the STA-mode statusServer in case we're serving from STA
-    statusServer.on("/config", HTTP_GET, handleDownloadConfigSTA);      // Route for STA mode
-    statusServer.on("/config.json", HTTP_GET, handleDownloadConfigSTA); // Alias
+    server.on("/config", HTTP_HEAD, handleDownloadConfigAP);
+    server.on("/config.json", HTTP_HEAD, handleDownloadConfigAP);
+    server.on("/logs", HTTP_GET, handleLogs);
+    server.collectHeaders(COLLECTED_HEADERS, sizeof(COLLECTED_HEADERS) / sizeof(COLLECTED_HEADERS[0]));
     server.begin();
 
     provisioningActive = true;
+    if (xTaskCreatePinnedToCore(provisioningTaskMain, "provisioning", PROVISIONING_STACK, nullptr, 1, &provisioningTask,
+                                NET_CORE) != pdPASS)
+    {
+        provisioningTask = nullptr;
+        Serial.println("Provisioning task failed to start; serving from the net scheduler");
+    }
 }
 
 void loopProvisioning()
 {
-    if (!provisioningActive)
+    // Only needed when the provisioning task could not be created.
+    if (!provisioningActive || provisioningTask)
         return;
     dnsServer.processNextRequest();
     server.handleClient();
+    scanTick();
+    connectTick();
 }
 
 bool isProvisioningActive() { return provisioningActive; }
@@ -4,10 +4,12 @@
 #include <WebServer.h>
 #include <DNSServer.h>
 
+// Start the AP, captive DNS and portal web server. DNS, HTTP and the /scan
+// cache are serviced by a dedicated FreeRTOS task.
 void startProvisioning();
+// Fallback for when the provisioning task could not be created; a no-op
+// otherwise.
 void loopProvisioning();
 bool isProvisioningActive();
-void startStatusServer();
-void loopStatusServer();
 
 #endif // PROVISIONING_H
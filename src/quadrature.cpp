@@ -0,0 +1,74 @@
+#include "quadrature.h"
+
+// Full-step table after Ben Buxton's rotary encoder decoder. Rows are
+// states, columns the (CLK << 1 | DT) input; both lines idle high at a
+// detent. DIR_* flags mark the transition that completes a detent.
+enum : uint8_t
+{
+    R_START,
+    R_CW_FINAL,
+    R_CW_BEGIN,
+    R_CW_NEXT,
+    R_CCW_BEGIN,
+    R_CCW_FINAL,
+    R_CCW_NEXT,
+    DIR_CW = 0x10,
+    DIR_CCW = 0x20,
+};
+
+static const uint8_t TRANSITIONS[7][4] = {
+    {R_START, R_CW_BEGIN, R_CCW_BEGIN, R_START},           // R_START
+    {R_CW_NEXT, R_START, R_CW_FINAL, R_START | DIR_CW},    // R_CW_FINAL
+    {R_CW_NEXT, R_CW_BEGIN, R_START, R_START},             // R_CW_BEGIN
+    {R_CW_NEXT, R_CW_BEGIN, R_CW_FINAL, R_START},          // R_CW_NEXT
+    {R_CCW_NEXT, R_START, R_CCW_BEGIN, R_START},           // R_CCW_BEGIN
+    {R_CCW_NEXT, R_CCW_FINAL, R_START, R_START | DIR_CCW}, // R_CCW_FINAL
+    {R_CCW_NEXT, R_CCW_FINAL, R_CCW_BEGIN, R_START},       // R_CCW_NEXT
+};
+
+int8_t QuadratureDecoder::scaled(int8_t dir, uint32_t nowUs)
+{
+    uint32_t gapMs = (nowUs - lastDetentUs) / 1000;
+    bool sameWay = dir == lastDir;
+    lastDir = dir;
+    lastDetentUs = nowUs;
+    if (!accel || !sameWay || gapMs >= ENCODER_ACCEL_MS)
+        return dir;
+    if (gapMs >= ENCODER_ACCEL_MS / 2)
+        return dir * 2;
+    if (gapMs >= ENCODER_ACCEL_MS / 4)
+        return dir * 4;
+    return dir * 8;
+}
+
+bool QuadratureDecoder::pins(bool clk, bool dt, uint32_t nowUs, EncoderEvent &ev)
+{
+    state = TRANSITIONS[state & 0x0F][(clk ? 2 : 0) | (dt ? 1 : 0)];
+    if (!(state & (DIR_CW | DIR_CCW)))
+        return false;
+    ev.type = EncoderEventType::Rotate;
+    ev.delta = scaled(state & DIR_CW ? 1 : -1, nowUs);
+    ev.atUs = nowUs;
+    return true;
+}
+
+bool QuadratureDecoder::sw(bool down, uint32_t nowUs, EncoderEvent &ev)
+{
+    // The ISR passes the level on every pin change, rotation included.
+    if (down == swDown)
+        return false;
+    swDown = down;
+    if (!down)
+    {
+        // Every release edge restarts the quiet period, so release chatter
+        // is not taken for a new press.
+        swReleasedUs = nowUs;
+        return false;
+    }
+    if (nowUs - swReleasedUs < ENCODER_SW_DEBOUNCE_US)
+        return false;
+    ev.type = EncoderEventType::Press;
+    ev.delta = 0;
+    ev.atUs = nowUs;
+    return true;
+}
@@ -0,0 +1,51 @@
+// quadrature.h
+// Pin-level decoding for the KY-040 rotary encoder, kept free of hardware
+// access so bounce-laden edge traces can be replayed on a host. The
+// RotaryEncoder ISR (encoder.h) feeds it every CLK/DT/SW level change.
+//
+// Rotation goes through a Gray-code full-step state table: a detent only
+// counts after all four transitions in order, so contact bounce (which
+// flips one signal back and forth) cannot produce steps. The switch uses a
+// leading-edge debounce: a press counts at once, unless the switch was
+// last seen released less than ENCODER_SW_DEBOUNCE_US earlier.
+#pragma once
+
+#include <stdint.h>
+
+static const uint32_t ENCODER_SW_DEBOUNCE_US = 30000;
+// With acceleration on, a detent less than ENCODER_ACCEL_MS after the
+// previous one in the same direction counts 2, 4 or 8 steps.
+static const uint32_t ENCODER_ACCEL_MS = 80;
+
+enum class EncoderEventType : uint8_t
+{
+    Rotate, // delta steps, positive clockwise
+    Press,
+};
+
+struct EncoderEvent
+{
+    EncoderEventType type;
+    int8_t delta;
+    uint32_t atUs;
+};
+
+class QuadratureDecoder
+{
+public:
+    void setAcceleration(bool on) { accel = on; }
+    // New CLK/DT levels at nowUs. Returns true and fills ev on a detent.
+    bool pins(bool clk, bool dt, uint32_t nowUs, EncoderEvent &ev);
+    // New switch level (true = pressed). Returns true and fills ev on a press.
+    bool sw(bool down, uint32_t nowUs, EncoderEvent &ev);
+
+private:
+    int8_t scaled(int8_t dir, uint32_t nowUs);
+
+    uint8_t state = 0;
+    bool accel = false;
+    int8_t lastDir = 0;
+    uint32_t lastDetentUs = 0;
+    bool swDown = false; // last level seen, bounces included
+    uint32_t swReleasedUs = 0;
+};
@@ -0,0 +1,155 @@
+#include "scheduler.h"
+#include "profiler.h"
+#include <Arduino.h>
+#include <atomic>
+
+// Longest single sleep; a runner still comes round this often with no task due.
+static const uint32_t MAX_SLEEP_US = 1000000;
+
+static const size_t DOMAIN_COUNT = 2;
+
+struct Task
+{
+    SchedDomain domain;
+    const char *name;
+    SchedFn fn;
+    uint32_t periodUs;
+    uint32_t deadlineUs;
+    uint32_t nextDue; // micros() of the next periodic release
+    uint8_t profile;  // profiler scope ("task", name)
+    // Set by schedWake(); wokenAt is written before woken is published.
+    std::atomic<bool> woken;
+    std::atomic<uint32_t> wokenAt;
+    SchedTaskStats stats;
+};
+
+static Task tasks[SCHED_MAX_TASKS];
+static size_t taskCount = 0;
+// Task running each domain, recorded by its first schedRun().
+static TaskHandle_t runners[DOMAIN_COUNT] = {};
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+static Task *findTask(SchedFn fn)
+{
+    for (size_t i = 0; i < taskCount; ++i)
+        if (tasks[i].fn == fn)
+            return &tasks[i];
+    return nullptr;
+}
+
+bool schedAdd(SchedDomain domain, const char *name, SchedFn fn, uint32_t periodMs, uint32_t deadlineMs)
+{
+    if (taskCount >= SCHED_MAX_TASKS || !fn)
+        return false;
+    Task &t = tasks[taskCount];
+    t.domain = domain;
+    t.name = name;
+    t.fn = fn;
+    t.periodUs = periodMs * 1000UL;
+    t.deadlineUs = (deadlineMs ? deadlineMs : periodMs) * 1000UL;
+    t.nextDue = micros();
+    t.profile = profileRegister("task", name);
+    t.woken.store(false, std::memory_order_relaxed);
+    t.stats = SchedTaskStats();
+    t.stats.name = name;
+    t.stats.domain = domain;
+    t.stats.periodMs = periodMs;
+    t.stats.deadlineMs = deadlineMs ? deadlineMs : periodMs;
+    ++taskCount;
+    return true;
+}
+
+void schedWake(SchedFn fn)
+{
+    Task *t = findTask(fn);
+    if (!t)
+        return;
+    t->wokenAt.store(micros(), std::memory_order_relaxed);
+    t->woken.store(true, std::memory_order_release);
+    TaskHandle_t runner = runners[(size_t)t->domain];
+    if (runner)
+        xTaskNotifyGive(runner);
+}
+
+static void record(Task &t, uint32_t release, uint32_t start, uint32_t end)
+{
+    uint32_t run = end - start;
+    uint32_t late = start - release;
+    portENTER_CRITICAL(&statsMux);
+    SchedTaskStats &s = t.stats;
+    s.runs++;
+    s.totalRunUs += run;
+    if (run > s.maxRunUs)
+        s.maxRunUs = run;
+    if (late > s.maxLateUs)
+        s.maxLateUs = late;
+    if (t.deadlineUs && end - release > t.deadlineUs)
+        s.overruns++;
+    portEXIT_CRITICAL(&statsMux);
+}
+
+void schedRun(SchedDomain domain)
+{
+    TaskHandle_t &runner = runners[(size_t)domain];
+    if (!runner)
+        runner = xTaskGetCurrentTaskHandle();
+
+    uint32_t now = micros();
+    for (size_t i = 0; i < taskCount; ++i)
+    {
+        Task &t = tasks[i];
+        if (t.domain != domain)
+            continue;
+        bool due = t.periodUs && (int32_t)(now - t.nextDue) >= 0;
+        bool woken = t.woken.exchange(false, std::memory_order_acquire);
+        if (!due && !woken)
+            continue;
+        uint32_t release = due ? t.nextDue : t.wokenAt.load(std::memory_order_relaxed);
+        uint32_t start = micros();
+        {
+            ProfileScope scope(t.profile);
+            t.fn();
+        }
+        uint32_t end = micros();
+        record(t, release, start, end);
+        if (due)
+        {
+            // Keep the phase, but after a stall skip the missed releases
+            // instead of running the task back to back to catch up.
+            t.nextDue += t.periodUs;
+            if ((int32_t)(end - t.nextDue) >= 0)
+                t.nextDue = end + t.periodUs;
+        }
+        now = end;
+    }
+
+    uint32_t wait = MAX_SLEEP_US;
+    for (size_t i = 0; i < taskCount && wait; ++i)
+    {
+        if (tasks[i].domain != domain || !tasks[i].periodUs)
+            continue;
+        int32_t until = (int32_t)(tasks[i].nextDue - micros());
+        if (until <= 0)
+            wait = 0;
+        else if ((uint32_t)until < wait)
+            wait = until;
+    }
+    // Under a tick the remainder is spun off by the next pass. A schedWake()
+    // that came in meanwhile left a notification pending, so this returns
+    // at once.
+    const uint32_t tickUs = portTICK_PERIOD_MS * 1000UL;
+    if (wait >= tickUs)
+        ulTaskNotifyTake(pdTRUE, (wait + tickUs - 1) / tickUs);
+}
+
+size_t schedTaskCount() { return taskCount; }
+
+bool schedTaskStats(size_t index, SchedTaskStats &out)
+{
+    if (index >= taskCount)
+        return false;
+    portENTER_CRITICAL(&statsMux);
+    out = tasks[index].stats;
+    portEXIT_CRITICAL(&statsMux);
+    return true;
+}
@@ -0,0 +1,51 @@
+// scheduler.h
+// Cooperative deadline scheduler. Subsystems register a function with a
+// period (and optionally a deadline) in a domain; schedRun() calls what is
+// due, in registration order, then blocks the calling task until the next
+// release or a schedWake(), so the idle task runs instead of spinning.
+// Tasks must not block: one that does delays everything behind it and shows
+// up as overruns in its own and the other tasks' stats.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef void (*SchedFn)();
+
+// Each domain is run by its own task (see cores.h): Ui by loop(), Net by the
+// "net" task. A task only ever runs on its domain's core.
+enum class SchedDomain : uint8_t
+{
+    Ui,
+    Net,
+};
+
+static const size_t SCHED_MAX_TASKS = 16;
+
+struct SchedTaskStats
+{
+    const char *name;
+    SchedDomain domain;
+    uint32_t periodMs;
+    uint32_t deadlineMs;
+    uint32_t runs;
+    uint32_t overruns;  // runs that finished later than release + deadline
+    uint32_t maxRunUs;  // longest single run
+    uint32_t maxLateUs; // worst release-to-start delay
+    uint64_t totalRunUs;
+};
+
+// Register fn to be released every periodMs; 0 means only on schedWake().
+// A run finishing more than deadlineMs after its release is an overrun
+// (0: the period; no deadline for a wake-only task). Call from setup();
+// returns false when the table is full.
+bool schedAdd(SchedDomain domain, const char *name, SchedFn fn, uint32_t periodMs, uint32_t deadlineMs = 0);
+// Release fn's task right away, from any task or core (not from an ISR).
+void schedWake(SchedFn fn);
+// Call repeatedly from the domain's task: runs its due tasks, then sleeps
+// until the next release.
+void schedRun(SchedDomain domain);
+
+size_t schedTaskCount();
+// Consistent copy of one task's counters; callable from any task.
+bool schedTaskStats(size_t index, SchedTaskStats &out);
@@ -0,0 +1,96 @@
+#include "sensors.h"
+#include "metrics.h"
+#include "profiler.h"
+#include "scheduler.h"
+#include "spsc_queue.h"
+#include <Arduino.h>
+#include <Adafruit_AHTX0.h>
+#include <Adafruit_BMP280.h>
+
+// Owned by the UI core.
+static Adafruit_AHTX0 *aht20 = nullptr;
+static Adafruit_BMP280 *bmp280 = nullptr;
+
+// UI core -> telemetry on the net core. Readings are absolute values and
+// only the newest is used; the consumer drains it every pass, so at most one
+// reading per request is ever queued.
+static SpscQueue<ClimateReading, 4> readings;
+
+void sensorsStart(const Config &cfg)
+{
+    if (!cfg.climate_enabled)
+        return;
+    aht20 = new Adafruit_AHTX0();
+    bmp280 = new Adafruit_BMP280();
+    if (aht20->begin())
+    {
+        Serial.println("AHT20 initialized");
+    }
+    else
+    {
+        Serial.println("AHT20 failed to initialize");
+    }
+    if (bmp280->begin(0x77)) // BMP280 default address
+    {
+        Serial.println("BMP280 initialized");
+    }
+    else
+    {
+        Serial.println("BMP280 failed to initialize");
+    }
+}
+
+void sensorsStop()
+{
+    delete aht20;
+    aht20 = nullptr;
+    delete bmp280;
+    bmp280 = nullptr;
+}
+
+bool sensorsRead(ClimateReading &out)
+{
+    out.tempF = out.humidity = out.pressureHpa = NAN;
+    out.atMs = millis();
+    if (!aht20 && !bmp280)
+        return false;
+    if (aht20)
+    {
+        PROFILE_SCOPE("i2c", "aht20");
+        sensors_event_t humidity, temp;
+        uint32_t start = micros();
+        bool ok = aht20->getEvent(&humidity, &temp);
+        metricsObserveI2c(MET_I2C_AHT20, micros() - start);
+        if (ok)
+        {
+            out.tempF = temp.temperature * 9.0F / 5.0F + 32.0F;
+            out.humidity = humidity.relative_humidity;
+        }
+    }
+    if (bmp280)
+    {
+        PROFILE_SCOPE("i2c", "bmp280");
+        uint32_t start = micros();
+        out.pressureHpa = bmp280->readPressure() / 100.0F;
+        metricsObserveI2c(MET_I2C_BMP280, micros() - start);
+    }
+    return true;
+}
+
+void sensorsTask()
+{
+    // Queued even when sensing is off, so the consumer drops stale values.
+    ClimateReading r;
+    sensorsRead(r);
+    readings.push(r);
+}
+
+void sensorsRequestReading()
+{
+    schedWake(sensorsTask);
+}
+
+bool sensorsTakeReading(ClimateReading &out)
+{
+    return readings.popLatest(out);
+}
@@ -0,0 +1,31 @@
+// sensors.h
+// AHT20 + BMP280 climate sensors. They share the I2C bus with the display,
+// so everything here runs on the UI core (cores.h); the network side only
+// sees readings handed over through a lock-free queue.
+#pragma once
+
+#include "config.h"
+#include <stdint.h>
+
+// NAN marks a value that is unavailable (no sensor or a failed read).
+struct ClimateReading
+{
+    float tempF;
+    float humidity;    // %RH
+    float pressureHpa;
+    uint32_t atMs;     // millis() when read
+};
+
+// (Re)create the sensors per cfg.climate_enabled; UI core only.
+void sensorsStart(const Config &cfg);
+void sensorsStop();
+// Blocking read on the UI core (an AHT20 conversion takes ~80 ms). Returns
+// false when climate sensing is disabled.
+bool sensorsRead(ClimateReading &out);
+// Scheduler task (wake-only, UI domain): reads once and queues the result.
+void sensorsTask();
+// Any core: ask the UI core for a fresh reading (wakes sensorsTask).
+void sensorsRequestReading();
+// Consumer side of the reading queue (the telemetry task only): the newest
+// queued reading, if any arrived since the last call.
+bool sensorsTakeReading(ClimateReading &out);
@@ -0,0 +1,61 @@
+#include "serial_console.h"
+#include "profiler.h"
+#include <Arduino.h>
+
+// Longest accepted command line; longer input is discarded up to its newline.
+static const size_t LINE_MAX = 48;
+
+static char line[LINE_MAX + 1];
+static size_t lineLen = 0;
+static bool overflow = false;
+
+static void runCommand(const char *cmd)
+{
+    if (strcmp(cmd, "profile") == 0)
+    {
+#if TB_PROFILE
+        profilePrint(Serial);
+#else
+        Serial.println("profiler compiled out (TB_PROFILE=0)");
+#endif
+    }
+    else if (strcmp(cmd, "profile reset") == 0)
+    {
+        profileReset();
+        Serial.println("profile reset");
+    }
+    else if (strcmp(cmd, "help") == 0)
+    {
+        Serial.println("commands: profile, profile reset, help");
+    }
+    else if (cmd[0] != '\0')
+    {
+        Serial.printf("unknown command '%s' (try 'help')\n", cmd);
+    }
+}
+
+void serialConsoleTask()
+{
+    while (Serial.available() > 0)
+    {
+        int c = Serial.read();
+        if (c < 0)
+            break;
+        if (c == '\r' || c == '\n')
+        {
+            line[lineLen] = '\0';
+            if (!overflow)
+                runCommand(line);
+            lineLen = 0;
+            overflow = false;
+        }
+        else if (lineLen < LINE_MAX)
+        {
+            line[lineLen++] = (char)c;
+        }
+        else
+        {
+            overflow = true;
+        }
+    }
+}
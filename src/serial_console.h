@@ -0,0 +1,10 @@
+// serial_console.h
+// Line-based commands on the USB serial port, for bench use without Wi-Fi:
+//   profile        print the profiler table (profiler.h)
+//   profile reset  clear the profiler statistics
+//   help           list the commands
+#pragma once
+
+// Scheduler task (net core): reads whatever input is pending without
+// blocking and runs a command once its line is complete.
+void serialConsoleTask();
@@ -0,0 +1,60 @@
+// spsc_queue.h
+// Fixed-size lock-free ring buffer between exactly one producer task and one
+// consumer task, used to pass readings and input events between the two
+// cores (see cores.h). push() and pop() never block or allocate; each index
+// is written by one side only, so plain acquire/release atomics suffice.
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+template <typename T, size_t N>
+class SpscQueue
+{
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+    // Producer side. Returns false, dropping item, when the queue is full.
+    bool push(const T &item)
+    {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) == N)
+        {
+            drops.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        slots[h & (N - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Returns false when empty.
+    bool pop(T &out)
+    {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (head.load(std::memory_order_acquire) == t)
+            return false;
+        out = slots[t & (N - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side: drain everything and keep only the newest item, for
+    // queues of absolute values where older entries are superseded.
+    bool popLatest(T &out)
+    {
+        bool any = false;
+        while (pop(out))
+            any = true;
+        return any;
+    }
+
+    uint32_t dropped() const { return drops.load(std::memory_order_relaxed); }
+
+private:
+    T slots[N];
+    std::atomic<uint32_t> head{0}; // next slot to write; producer only
+    std::atomic<uint32_t> tail{0}; // next slot to read; consumer only
+    std::atomic<uint32_t> drops{0};
+};
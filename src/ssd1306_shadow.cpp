@@ -0,0 +1,232 @@
+#include "ssd1306_shadow.h"
+#include "profiler.h"
+#include <string.h>
+
+// Data bytes per I2C transaction: the Wire buffer minus the 0x40 control
+// byte, as in Adafruit_SSD1306::display().
+static const size_t DATA_PER_TX = I2C_BUFFER_LENGTH - 1;
+// Setting a window costs one command transaction (address, control byte
+// and six command bytes) plus the address and control byte of its data.
+static const size_t WINDOW_OVERHEAD = 10;
+// At most this many windows per frame; more means a full frame is cheaper.
+static const size_t MAX_WINDOWS = 24;
+
+// Guards the frame handoff (pointers, pendingFull, pendingAt); held only for
+// a pointer swap. There is one display, so one lock is enough.
+static portMUX_TYPE frameMux = portMUX_INITIALIZER_UNLOCKED;
+
+struct Window
+{
+    uint8_t page;
+    uint8_t col0;
+    uint8_t col1;
+};
+
+// Bytes on the wire for a window of len data bytes.
+static size_t windowCost(size_t len)
+{
+    return WINDOW_OVERHEAD + len + 2 * ((len - 1) / DATA_PER_TX);
+}
+
+bool ShadowSSD1306::begin(uint8_t vcs, uint8_t addr, bool reset, bool periphBegin)
+{
+    invalidate();
+    return Adafruit_SSD1306::begin(vcs, addr, reset, periphBegin);
+}
+
+uint16_t ShadowSSD1306::sendWindow(const uint8_t *frame, uint8_t page0, uint8_t page1, uint8_t col0, uint8_t col1)
+{
+    const uint8_t cmds[] = {SSD1306_PAGEADDR, page0, page1, SSD1306_COLUMNADDR, col0, col1};
+    ssd1306_commandList(cmds, sizeof(cmds));
+    uint16_t bytes = 2 + sizeof(cmds);
+
+    // The controller fills the window column by column, page after page.
+    bool open = false;
+    size_t inTx = 0;
+    for (uint8_t page = page0; page <= page1; ++page)
+    {
+        const uint8_t *src = frame + (size_t)page * WIDTH;
+        for (uint8_t col = col0; col <= col1; ++col)
+        {
+            if (!open || inTx == DATA_PER_TX)
+            {
+                if (open)
+                    wire->endTransmission();
+                open = true;
+                wire->beginTransmission(i2caddr);
+                wire->write((uint8_t)0x40);
+                bytes += 2;
+                inTx = 0;
+            }
+            wire->write(src[col]);
+            ++inTx;
+            ++bytes;
+        }
+    }
+    wire->endTransmission();
+    return bytes;
+}
+
+ShadowSSD1306::FlushStats ShadowSSD1306::flushFrame(const uint8_t *frame)
+{
+    PROFILE_SCOPE("i2c", "display");
+    FlushStats stats = {0, 0, false, 0};
+    if (!buffer || !wire)
+        return stats;
+    const uint8_t pages = (HEIGHT + 7) / 8;
+    const size_t frameBytes = (size_t)WIDTH * pages;
+    const size_t fullCost = windowCost(frameBytes);
+    if (resync.exchange(false, std::memory_order_relaxed))
+        shadowValid = false;
+
+    // Changed column runs per page; gaps cheaper to resend than to skip
+    // are merged into the run.
+    Window windows[MAX_WINDOWS];
+    size_t count = 0;
+    size_t cost = 0;
+    bool full = !shadowValid;
+    for (uint8_t page = 0; page < pages && !full; ++page)
+    {
+        const uint8_t *cur = frame + (size_t)page * WIDTH;
+        const uint8_t *old = shadow + (size_t)page * WIDTH;
+        int col = 0;
+        while (col < WIDTH && !full)
+        {
+            if (cur[col] == old[col])
+            {
+                ++col;
+                continue;
+            }
+            int start = col;
+            int end = col;
+            for (int c = col + 1; c < WIDTH && c - end <= (int)WINDOW_OVERHEAD; ++c)
+            {
+                if (cur[c] != old[c])
+                    end = c;
+            }
+            if (count == MAX_WINDOWS)
+            {
+                full = true;
+                break;
+            }
+            windows[count++] = {page, (uint8_t)start, (uint8_t)end};
+            cost += windowCost(end - start + 1);
+            col = end + 1;
+        }
+    }
+    if (!full && count == 0)
+        return stats;
+    if (cost >= fullCost)
+        full = true;
+
+    uint32_t start = micros();
+    if (wireClk)
+        wire->setClock(wireClk);
+    if (full)
+    {
+        stats.bytes = sendWindow(frame, 0, pages - 1, 0, WIDTH - 1);
+        stats.windows = 1;
+        stats.full = true;
+    }
+    else
+    {
+        for (size_t i = 0; i < count; ++i)
+            stats.bytes += sendWindow(frame, windows[i].page, windows[i].page, windows[i].col0, windows[i].col1);
+        stats.windows = count;
+    }
+    if (restoreClk)
+        wire->setClock(restoreClk);
+    stats.busUs = micros() - start;
+
+    memcpy(shadow, frame, frameBytes);
+    shadowValid = true;
+    return stats;
+}
+
+void ShadowSSD1306::taskMain(void *arg)
+{
+    ShadowSSD1306 *self = static_cast<ShadowSSD1306 *>(arg);
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        portENTER_CRITICAL(&frameMux);
+        bool have = self->pendingFull;
+        uint32_t submittedAt = self->pendingAt;
+        if (have)
+        {
+            uint8_t *t = self->sending;
+            self->sending = self->pending;
+            self->pending = t;
+            self->pendingFull = false;
+            self->busy.store(true, std::memory_order_relaxed);
+        }
+        portEXIT_CRITICAL(&frameMux);
+        if (!have)
+            continue;
+        FlushStats stats = self->flushFrame(self->sending);
+        uint32_t latency = micros() - submittedAt;
+        self->busy.store(false, std::memory_order_release);
+        if (self->hook)
+            self->hook(stats, latency);
+    }
+}
+
+bool ShadowSSD1306::startFlushTask(int core, uint32_t stackBytes, unsigned priority)
+{
+    if (task)
+        return true;
+    if ((size_t)WIDTH * ((HEIGHT + 7) / 8) > FRAME_MAX)
+        return false;
+    if (xTaskCreatePinnedToCore(taskMain, "oled", stackBytes, this, priority, &task, core) != pdPASS)
+    {
+        task = nullptr;
+        return false;
+    }
+    return true;
+}
+
+bool ShadowSSD1306::submit()
+{
+    const size_t frameBytes = (size_t)WIDTH * ((HEIGHT + 7) / 8);
+    if (frameBytes > FRAME_MAX)
+    {
+        display();
+        return true;
+    }
+    uint32_t now = micros();
+    if (!task)
+    {
+        FlushStats stats = flushFrame(buffer);
+        if (hook)
+            hook(stats, micros() - now);
+        return true;
+    }
+
+    memcpy(back, buffer, frameBytes);
+    portENTER_CRITICAL(&frameMux);
+    bool replaced = pendingFull;
+    uint8_t *t = pending;
+    pending = back;
+    back = t;
+    pendingFull = true;
+    pendingAt = now;
+    portEXIT_CRITICAL(&frameMux);
+    xTaskNotifyGive(task);
+    return !replaced;
+}
+
+bool ShadowSSD1306::waitIdle(uint32_t timeoutMs)
+{
+    uint32_t start = millis();
+    for (;;)
+    {
+        portENTER_CRITICAL(&frameMux);
+        bool idle = !pendingFull && !busy.load(std::memory_order_acquire);
+        portEXIT_CRITICAL(&frameMux);
+        if (idle)
+            return true;
+        if (millis() - start >= timeoutMs)
+            return false;
+        delay(1);
+    }
+}
@@ -0,0 +1,75 @@
+// ssd1306_shadow.h
+// Adafruit_SSD1306 with a shadow copy of what the panel shows, and an
+// optional background task that does the I2C transfer.
+//
+// A flush compares a frame against the shadow and sends only the changed
+// column runs of each page, each through the controller's page/column
+// addressing window, instead of display()'s full 1 KB frame. Runs closer
+// together than a window's setup cost are merged, and a frame that changed
+// almost everywhere goes out as one full window.
+//
+// Once startFlushTask() succeeded, submit() copies the framebuffer into a
+// back buffer, swaps it with the pending one and returns; the task sends
+// the newest pending frame. A frame that is replaced before the task got to
+// it is dropped, never queued, so a slow bus costs frames, not latency.
+// Before that (or if the task could not start) submit() flushes inline.
+#pragma once
+
+#include <Adafruit_SSD1306.h>
+#include <atomic>
+
+class ShadowSSD1306 : public Adafruit_SSD1306
+{
+public:
+    struct FlushStats
+    {
+        uint16_t bytes;  // bytes on the wire: address, control, commands, data
+        uint8_t windows; // addressing windows sent; 0 = nothing changed
+        bool full;       // the whole frame was sent
+        uint32_t busUs;  // time spent sending
+    };
+    // Called after every flush, on the task that did it; latencyUs runs
+    // from submit() to the end of the transfer.
+    typedef void (*FlushHook)(const FlushStats &stats, uint32_t latencyUs);
+
+    ShadowSSD1306(uint8_t w, uint8_t h, TwoWire *twi, int8_t rstPin) : Adafruit_SSD1306(w, h, twi, rstPin) {}
+
+    // As Adafruit_SSD1306::begin(); the next flush sends the full frame.
+    // Call waitIdle() first if the flush task is running.
+    bool begin(uint8_t vcs = SSD1306_SWITCHCAPVCC, uint8_t addr = 0, bool reset = true, bool periphBegin = true);
+    void setFlushHook(FlushHook fn) { hook = fn; }
+    bool startFlushTask(int core, uint32_t stackBytes, unsigned priority);
+    // Hand the framebuffer over for sending. Returns false when this
+    // replaced a frame that had not gone out yet.
+    bool submit();
+    // Block until nothing is pending or in flight, e.g. before touching
+    // the bus. Returns false on timeout.
+    bool waitIdle(uint32_t timeoutMs);
+    // Forget what the panel shows, e.g. after it was written some other way.
+    void invalidate() { resync.store(true, std::memory_order_relaxed); }
+
+private:
+    // Largest panel handled; a bigger one is flushed with display().
+    static const size_t FRAME_MAX = 128 * 64 / 8;
+
+    static void taskMain(void *arg);
+    FlushStats flushFrame(const uint8_t *frame);
+    uint16_t sendWindow(const uint8_t *frame, uint8_t page0, uint8_t page1, uint8_t col0, uint8_t col1);
+
+    FlushHook hook = nullptr;
+    // Owned by whoever flushes (the task once it runs).
+    uint8_t shadow[FRAME_MAX];
+    bool shadowValid = false;
+    std::atomic<bool> resync{true};
+
+    // Triple buffer: submit() fills back and swaps it with pending; the
+    // task swaps pending with sending. The swaps happen under a spinlock.
+    uint8_t frames[3][FRAME_MAX];
+    uint8_t *back = frames[0];
+    uint8_t *pending = frames[1];
+    uint8_t *sending = frames[2];
+    bool pendingFull = false;
+    uint32_t pendingAt = 0;
+    std::atomic<bool> busy{false};
+    TaskHandle_t task = nullptr;
+};
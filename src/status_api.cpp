@@ -0,0 +1,85 @@
+#include "status_api.h"
+#include "wifi_link.h"
+#include <WiFi.h>
+
+// Random per-boot token mixed into status ETags. The config generation
+// restarts at 0 on every boot, so without it a client could see a stale
+// ETag match after a reboot.
+static uint32_t bootToken()
+{
+    static uint32_t token = 0;
+    if (token == 0)
+        token = esp_random() | 1;
+    return token;
+}
+
+StatusView captureStatus()
+{
+    StatusView v;
+    v.snap = configSnapshot();
+    v.wifiStatus = WiFi.status();
+    v.ip = (v.wifiStatus == WL_CONNECTED) ? WiFi.localIP() : IPAddress();
+    return v;
+}
+
+void statusETag(const StatusView &v, char *out, size_t outSize)
+{
+    snprintf(out, outSize, "\"%08lx-%lu-%d-%08lx\"", (unsigned long)bootToken(),
+             (unsigned long)v.snap->generation, v.wifiStatus, (unsigned long)(uint32_t)v.ip);
+}
+
+void writeStatusJson(JsonWriter &w, const StatusView &v)
+{
+    // Return JSON with masked SSID/PSK and connection status
+    const Config &current = v.snap->cfg;
+    bool has = v.snap->valid;
+
+    w.beginObject();
+    w.key("configured").boolean(has);
+    if (has)
+    {
+        // mask PSK and OTA password for safety
+        char pskMasked[sizeof(current.psk)];
+        char otaMasked[sizeof(current.ota_password)];
+        maskSecret(current.psk, pskMasked, sizeof(pskMasked));
+        maskSecret(current.ota_password, otaMasked, sizeof(otaMasked));
+        w.key("ssid").str(current.ssid);
+        w.key("psk_masked").str(pskMasked);
+        w.key("devname").str(current.devname);
+        w.key("ota_password_masked").str(otaMasked);
+    }
+    else
+    {
+        w.key("ssid").str("");
+        w.key("psk_masked").str("");
+        w.key("devname").str("");
+    }
+
+    w.key("wifi_status").numSigned(v.wifiStatus);
+    char ip[16] = "";
+    if (v.wifiStatus == WL_CONNECTED)
+        snprintf(ip, sizeof(ip), "%u.%u.%u.%u", v.ip[0], v.ip[1], v.ip[2], v.ip[3]);
+    w.key("ip").str(ip);
+    w.key("firmware_version").str(FW_VERSION);
+    w.endObject();
+}
+
+void writeHealthJson(JsonWriter &w)
+{
+    w.beginObject();
+    w.key("uptime_s").num(millis() / 1000UL);
+    w.key("free_heap").num(ESP.getFreeHeap());
+    w.key("max_alloc_heap").num(ESP.getMaxAllocHeap());
+    w.key("min_free_heap").num(ESP.getMinFreeHeap());
+    WifiLinkStats link = wifiLinkStats();
+    w.key("wifi").beginObject();
+    w.key("up").boolean(link.up);
+    w.key("reconnects").num(link.reconnects);
+    w.key("outage_ms").num(link.outageMs);
+    w.key("last_outage_ms").num(link.lastOutageMs);
+    w.key("longest_outage_ms").num(link.longestOutageMs);
+    w.key("total_outage_ms").num(link.totalOutageMs);
+    w.key("last_reason").num(link.lastReason);
+    w.endObject();
+    w.endObject();
+}
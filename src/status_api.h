@@ -0,0 +1,41 @@
+// status_api.h
+// Transport-neutral builders for the status endpoints. Shared by the AP-mode
+// WebServer (provisioning.cpp) and the STA-mode HTTP server
+// (status_server.cpp) so both report identical payloads and ETags.
+#pragma once
+
+#include <Arduino.h>
+#include <IPAddress.h>
+#include "config.h"
+#include "json_writer.h"
+#include "build_info.h"
+
+// Everything /status reports, captured once per request so the ETag and the
+// body are computed from the same values.
+struct StatusView
+{
+    std::shared_ptr<const ConfigSnapshot> snap;
+    int wifiStatus;
+    IPAddress ip; // 0.0.0.0 unless connected
+};
+
+StatusView captureStatus();
+
+// Strong ETag (with quotes) for a StatusView: per-boot token, config
+// generation, Wi-Fi status and IP. out should hold at least 48 bytes.
+void statusETag(const StatusView &v, char *out, size_t outSize);
+
+// Buffer sizes that always fit the bodies below: ssid and devname may escape
+// every byte as \u00XX, masked secrets are plain '*' runs, and 160 covers the
+// keys, punctuation, status code and IP.
+static const size_t STATUS_JSON_MAX = 160 + 6 * (sizeof(Config::ssid) - 1) + 6 * (sizeof(Config::devname) - 1) +
+                                      sizeof(Config::psk) + sizeof(Config::ota_password) + sizeof(FW_VERSION);
+static const size_t HEALTH_JSON_MAX = 320;
+
+// /status JSON body: masked SSID/PSK, devname, Wi-Fi status, IP, firmware.
+void writeStatusJson(JsonWriter &w, const StatusView &v);
+
+// /health JSON body: uptime, free heap, largest allocatable block and the
+// free-heap low-water mark (for spotting fragmentation over long uptimes),
+// plus the Wi-Fi link supervisor's reconnect and outage counters.
+void writeHealthJson(JsonWriter &w);
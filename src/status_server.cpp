@@ -0,0 +1,613 @@
+#include "status_server.h"
+#include "status_api.h"
+#include "config.h"
+#include "config_schema.h"
+#include "logger.h"
+#include "file_stream.h"
+#include "metrics.h"
+#include "telemetry.h"
+#include "cores.h"
+#include "profiler.h"
+#ifdef TB_UI_STRESS
+#include "display.h"
+#endif
+#include <Arduino.h>
+#include <esp_http_server.h>
+#include <lwip/sockets.h>
+
+static httpd_handle_t httpd = nullptr;
+
+// Sockets kept open for clients. Arduino's lwIP is built with 16 sockets and
+// httpd needs max_open_sockets <= 16 - 3; leave a few more for ArduinoOTA and
+// mDNS. When a new connection takes the last one, the least recently used
+// keep-alive connection is closed to make room (see onSocketOpen()); /events
+// subscribers are exempt, so they never count as idle.
+static const uint16_t MAX_OPEN_SOCKETS = 10;
+
+// One-line request summary ("<label> from <remote ip>"); at debug level also
+// the headers the handlers look at. esp_http_server cannot enumerate headers.
+static void logRequest(httpd_req_t *req, const char *label)
+{
+    if (!logEnabled(LOG_LEVEL_INFO))
+        return;
+    char addr[INET6_ADDRSTRLEN] = "?";
+    struct sockaddr_in6 peer;
+    socklen_t len = sizeof(peer);
+    int fd = httpd_req_to_sockfd(req);
+    if (getpeername(fd, (struct sockaddr *)&peer, &len) == 0)
+    {
+        if (peer.sin6_family == AF_INET)
+            inet_ntop(AF_INET, &((struct sockaddr_in *)&peer)->sin_addr, addr, sizeof(addr));
+        else
+            inet_ntop(AF_INET6, &peer.sin6_addr, addr, sizeof(addr));
+    }
+    LOG_I("%s (STA) from %s", label, addr);
+    if (logEnabled(LOG_LEVEL_DEBUG))
+    {
+        static const char *const DEBUG_HEADERS[] = {"Host", "User-Agent", "If-None-Match", "Content-Type"};
+        char value[64];
+        for (size_t i = 0; i < sizeof(DEBUG_HEADERS) / sizeof(DEBUG_HEADERS[0]); ++i)
+        {
+            if (httpd_req_get_hdr_value_str(req, DEBUG_HEADERS[i], value, sizeof(value)) == ESP_OK)
+                LOG_D("  %s: %s", DEBUG_HEADERS[i], value);
+        }
+    }
+}
+
+static esp_err_t sendText(httpd_req_t *req, const char *status, const char *text)
+{
+    httpd_resp_set_status(req, status);
+    httpd_resp_set_type(req, "text/plain");
+    return httpd_resp_sendstr(req, text);
+}
+
+static esp_err_t handleStatus(httpd_req_t *req)
+{
+    logRequest(req, "/status");
+    StatusView v = captureStatus();
+    char etag[48];
+    statusETag(v, etag, sizeof(etag));
+    httpd_resp_set_hdr(req, "ETag", etag);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+
+    char inm[48];
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", inm, sizeof(inm)) == ESP_OK && strcmp(inm, etag) == 0)
+    {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, nullptr, 0);
+    }
+
+    char body[STATUS_JSON_MAX];
+    JsonWriter w(body, sizeof(body));
+    writeStatusJson(w, v);
+    size_t len = w.finish();
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_send(req, body, len);
+}
+
+static esp_err_t handleHealth(httpd_req_t *req)
+{
+    logRequest(req, "/health");
+    char body[HEALTH_JSON_MAX];
+    JsonWriter w(body, sizeof(body));
+    writeHealthJson(w);
+    size_t len = w.finish();
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_send(req, body, len);
+}
+
+// GET/HEAD /config and /config.json: the raw LittleFS config.json.
+static esp_err_t handleConfigFile(httpd_req_t *req)
+{
+    logRequest(req, req->uri);
+    return sendFile(req, "/config.json", "application/json");
+}
+
+// Content type for a /files/ download, by extension.
+static const char *fileContentType(const char *path)
+{
+    static const struct
+    {
+        const char *ext;
+        const char *type;
+    } TYPES[] = {
+        {".json", "application/json"},
+        {".txt", "text/plain"},
+        {".log", "text/plain"},
+        {".csv", "text/csv"},
+    };
+    const char *dot = strrchr(path, '.');
+    for (size_t i = 0; dot && i < sizeof(TYPES) / sizeof(TYPES[0]); ++i)
+    {
+        if (strcmp(dot, TYPES[i].ext) == 0)
+            return TYPES[i].type;
+    }
+    return "application/octet-stream";
+}
+
+// GET/HEAD /files/<name>: download from the LittleFS /files directory, the
+// home for bulk data (learned codes, logs, histories). config.json and the
+// rest of the filesystem are not reachable through it.
+static esp_err_t handleFilesDownload(httpd_req_t *req)
+{
+    logRequest(req, req->uri);
+    size_t uriLen = strcspn(req->uri, "?");
+    char path[64];
+    if (uriLen >= sizeof(path) || strstr(req->uri, ".."))
+        return sendText(req, "404 Not Found", "not found");
+    memcpy(path, req->uri, uriLen); // "/files/..." maps 1:1 onto LittleFS
+    path[uriLen] = '\0';
+    return sendFile(req, path, fileContentType(path));
+}
+
+// JsonWriter / metrics sink: one HTTP chunk per full buffer.
+static bool sendChunk(void *ctx, const char *data, size_t len)
+{
+    return httpd_resp_send_chunk(static_cast<httpd_req_t *>(ctx), data, len) == ESP_OK;
+}
+
+// GET /logs?since=<seq>: recent log entries, streamed in chunks.
+static esp_err_t handleLogs(httpd_req_t *req)
+{
+    uint32_t since = 0;
+    char query[32];
+    char value[12];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "since", value, sizeof(value)) == ESP_OK)
+        since = strtoul(value, nullptr, 10);
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    char buf[512];
+    JsonWriter w(buf, sizeof(buf), sendChunk, req);
+    logWriteJson(w, since);
+    if (w.finish() == 0)
+        return ESP_FAIL; // client went away; httpd closes the socket
+    return httpd_resp_send_chunk(req, nullptr, 0);
+}
+
+#ifdef TB_UI_STRESS
+// POST /debug/ui-stress?seconds=N: redraw the display continuously for N
+// seconds (default 30, 0 stops). Only in stress-test builds.
+static esp_err_t handleUiStress(httpd_req_t *req)
+{
+    unsigned long seconds = 30;
+    char query[32];
+    char value[8];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "seconds", value, sizeof(value)) == ESP_OK)
+        seconds = strtoul(value, nullptr, 10);
+    if (seconds > 600)
+        seconds = 600;
+    displayStress(seconds * 1000UL);
+    LOG_I("UI stress for %lu s", seconds);
+    return sendText(req, "200 OK", "ok\n");
+}
+#endif
+
+// Names reported by PATCH /config for each ConfigImpact bit.
+static const struct
+{
+    uint8_t bit;
+    const char *name;
+} IMPACT_NAMES[] = {
+    {CFG_IMPACT_DISPLAY, "display"},
+    {CFG_IMPACT_ENCODER, "encoder"},
+    {CFG_IMPACT_MDNS, "mdns"},
+    {CFG_IMPACT_OTA, "ota"},
+    {CFG_IMPACT_CLIMATE, "climate"},
+};
+
+// PATCH /config: apply a JSON merge patch to the current config, persist it
+// through saveConfig() and report which subsystems will be re-initialized.
+// The running subsystems pick the new snapshot up on each core via
+// applyNetConfigChanges() / applyUiConfigChanges(); only Wi-Fi credential
+// changes cause a reboot.
+static esp_err_t handlePatchConfig(httpd_req_t *req)
+{
+    logRequest(req, "PATCH /config");
+    if (req->content_len == 0)
+        return sendText(req, "400 Bad Request", "JSON merge-patch body required");
+    // A valid patch can never be longer than a full serialized config.
+    if (req->content_len >= CONFIG_JSON_MAX)
+        return sendText(req, "413 Payload Too Large", "Patch too large");
+
+    char body[CONFIG_JSON_MAX];
+    size_t got = 0;
+    while (got < req->content_len)
+    {
+        int r = httpd_req_recv(req, body + got, req->content_len - got);
+        if (r == HTTPD_SOCK_ERR_TIMEOUT)
+            continue;
+        if (r <= 0)
+            return ESP_FAIL;
+        got += r;
+    }
+
+    std::shared_ptr<const ConfigSnapshot> snap = configSnapshot();
+    Config next = snap->cfg;
+    const char *badField = nullptr;
+    if (!configMergePatch(next, body, got, &badField))
+    {
+        if (badField)
+        {
+            char msg[64];
+            snprintf(msg, sizeof(msg), "Invalid value for %s", badField);
+            return sendText(req, "422 Unprocessable Entity", msg);
+        }
+        return sendText(req, "400 Bad Request", "Malformed JSON merge-patch");
+    }
+    if (next.ssid[0] == '\0')
+        return sendText(req, "422 Unprocessable Entity", "SSID required");
+    if (next.static_ip[0] && !next.static_gateway[0])
+        return sendText(req, "422 Unprocessable Entity", "static_gateway required with static_ip");
+
+    uint8_t impact = configDiff(snap->cfg, next);
+    if (!saveConfig(next))
+        return sendText(req, "500 Internal Server Error", "Failed to save config");
+
+    char json[128];
+    JsonWriter w(json, sizeof(json));
+    w.beginObject();
+    w.key("generation").num(configGeneration());
+    w.key("reload").beginArray();
+    for (size_t i = 0; i < sizeof(IMPACT_NAMES) / sizeof(IMPACT_NAMES[0]); ++i)
+    {
+        if (impact & IMPACT_NAMES[i].bit)
+            w.str(IMPACT_NAMES[i].name);
+    }
+    w.endArray();
+    w.key("reboot").boolean(impact & CFG_IMPACT_REBOOT);
+    w.endObject();
+    size_t len = w.finish();
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_send(req, json, len);
+}
+
+// GET /metrics: Prometheus text exposition, streamed in chunks.
+static esp_err_t handleMetrics(httpd_req_t *req)
+{
+    httpd_resp_set_type(req, "text/plain; version=0.0.4; charset=utf-8");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    if (!metricsWrite(sendChunk, req))
+        return ESP_FAIL;
+    return httpd_resp_send_chunk(req, nullptr, 0);
+}
+
+#if TB_PROFILE
+// GET /profile: per-scope cycle-count profile (see profiler.h), streamed.
+static esp_err_t handleProfile(httpd_req_t *req)
+{
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    char buf[512];
+    JsonWriter w(buf, sizeof(buf), sendChunk, req);
+    profileWriteJson(w);
+    if (w.finish() == 0)
+        return ESP_FAIL;
+    return httpd_resp_send_chunk(req, nullptr, 0);
+}
+
+// POST /profile/reset: clear every scope's statistics.
+static esp_err_t handleProfileReset(httpd_req_t *req)
+{
+    logRequest(req, "POST /profile/reset");
+    profileReset();
+    return sendText(req, "200 OK", "ok\n");
+}
+#endif
+
+// ---- GET /events (Server-Sent Events) ----
+//
+// A subscriber's socket stays with httpd (keep-alive, close on error) after
+// handleEvents() returns; frames are written to it directly with
+// httpd_socket_send(). eventFds is only touched on the httpd task: in the
+// handler, in broadcastEvent() (queued with httpd_queue_work()) and in
+// onSocketOpen()/onSocketClose().
+
+static const uint8_t MAX_EVENT_SUBSCRIBERS = 4;
+static int eventFds[MAX_EVENT_SUBSCRIBERS] = {-1, -1, -1, -1};
+static volatile uint8_t eventSubscribers = 0;
+
+// The frame waiting for broadcastEvent(); pendingLen is 0 when none is queued.
+static portMUX_TYPE pendingMux = portMUX_INITIALIZER_UNLOCKED;
+static char pendingEvent[TELEMETRY_EVENT_MAX];
+static size_t pendingLen = 0;
+
+static void dropSubscriber(size_t i)
+{
+    eventFds[i] = -1;
+    eventSubscribers = eventSubscribers - 1;
+}
+
+static esp_err_t handleEvents(httpd_req_t *req)
+{
+    logRequest(req, "/events");
+    size_t slot = 0;
+    while (slot < MAX_EVENT_SUBSCRIBERS && eventFds[slot] >= 0)
+        ++slot;
+    if (slot == MAX_EVENT_SUBSCRIBERS)
+        return sendText(req, "503 Service Unavailable", "Too many event subscribers");
+
+    // No Content-Length and no chunking: the stream ends when the socket
+    // closes, which is what EventSource expects.
+    static const char HEAD[] = "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\n"
+                               "Cache-Control: no-store\r\n\r\n";
+    if (httpd_send(req, HEAD, sizeof(HEAD) - 1) != (int)(sizeof(HEAD) - 1))
+        return ESP_FAIL;
+    char frame[TELEMETRY_EVENT_MAX];
+    size_t len = telemetryFormatSnapshot(frame, sizeof(frame));
+    if (len && httpd_send(req, frame, len) != (int)len)
+        return ESP_FAIL;
+    eventFds[slot] = httpd_req_to_sockfd(req);
+    eventSubscribers = eventSubscribers + 1;
+    return ESP_OK;
+}
+
+static void broadcastEvent(void *)
+{
+    char frame[TELEMETRY_EVENT_MAX];
+    portENTER_CRITICAL(&pendingMux);
+    size_t len = pendingLen;
+    memcpy(frame, pendingEvent, len);
+    pendingLen = 0;
+    portEXIT_CRITICAL(&pendingMux);
+
+    for (size_t i = 0; i < MAX_EVENT_SUBSCRIBERS; ++i)
+    {
+        int fd = eventFds[i];
+        if (fd < 0)
+            continue;
+        if (httpd_socket_send(httpd, fd, frame, len, 0) != (int)len)
+        {
+            dropSubscriber(i);
+            httpd_sess_trigger_close(httpd, fd);
+        }
+    }
+}
+
+static bool isEventSubscriber(int fd)
+{
+    for (size_t i = 0; i < MAX_EVENT_SUBSCRIBERS; ++i)
+    {
+        if (eventFds[i] == fd)
+            return true;
+    }
+    return false;
+}
+
+// ---- Connection slots ----
+//
+// httpd's own LRU purge would pick /events subscribers first: frames sent
+// with httpd_socket_send() do not count as activity, so a subscriber looks
+// idle forever. Purging is therefore done here instead, on the httpd task:
+// every open socket is tracked with the sequence number of its last request,
+// and subscribers are never chosen.
+
+struct Session
+{
+    int fd;           // -1: free
+    uint32_t lastUse; // useCounter at the last request
+};
+static Session sessions[MAX_OPEN_SOCKETS];
+static uint32_t useCounter = 0;
+
+static void touchSession(int fd)
+{
+    for (Session &s : sessions)
+    {
+        if (s.fd == fd)
+            s.lastUse = ++useCounter;
+    }
+}
+
+// open_fn: track the new socket. When it took the last slot, close the least
+// recently used connection that is not a subscriber, so the next client is
+// accepted instead of waiting in the backlog.
+static esp_err_t onSocketOpen(httpd_handle_t hd, int fd)
+{
+    Session *slot = nullptr;
+    size_t used = 1;
+    for (Session &s : sessions)
+    {
+        if (s.fd >= 0)
+            ++used;
+        else if (!slot)
+            slot = &s;
+    }
+    if (!slot)
+        return ESP_FAIL; // httpd refuses the connection
+    slot->fd = fd;
+    slot->lastUse = ++useCounter;
+    if (used < MAX_OPEN_SOCKETS)
+        return ESP_OK;
+    Session *victim = nullptr;
+    for (Session &s : sessions)
+    {
+        if (s.fd < 0 || s.fd == fd || isEventSubscriber(s.fd))
+            continue;
+        if (!victim || (int32_t)(s.lastUse - victim->lastUse) < 0)
+            victim = &s;
+    }
+    if (victim)
+        httpd_sess_trigger_close(hd, victim->fd);
+    return ESP_OK;
+}
+
+// close_fn: httpd calls this for every socket it closes and leaves the
+// close() to us.
+static void onSocketClose(httpd_handle_t, int fd)
+{
+    for (size_t i = 0; i < MAX_EVENT_SUBSCRIBERS; ++i)
+    {
+        if (eventFds[i] == fd)
+            dropSubscriber(i);
+    }
+    for (Session &s : sessions)
+    {
+        if (s.fd == fd)
+            s.fd = -1;
+    }
+    close(fd);
+}
+
+uint8_t eventSubscriberCount() { return httpd ? eventSubscribers : 0; }
+
+bool publishEvent(const char *data, size_t len)
+{
+    if (!httpd || len == 0 || len > sizeof(pendingEvent))
+        return false;
+    portENTER_CRITICAL(&pendingMux);
+    bool busy = pendingLen != 0;
+    if (!busy)
+    {
+        memcpy(pendingEvent, data, len);
+        pendingLen = len;
+    }
+    portEXIT_CRITICAL(&pendingMux);
+    if (busy)
+        return false;
+    if (httpd_queue_work(httpd, broadcastEvent, nullptr) != ESP_OK)
+    {
+        portENTER_CRITICAL(&pendingMux);
+        pendingLen = 0;
+        portEXIT_CRITICAL(&pendingMux);
+        return false;
+    }
+    return true;
+}
+
+static esp_err_t handleNotFound(httpd_req_t *req, httpd_err_code_t)
+{
+    LOG_W("STA notFound URI: %s", req->uri);
+    sendText(req, "404 Not Found", "Not found");
+    return ESP_OK; // keep the connection open
+}
+
+// A route plus the request histogram it is timed into.
+struct Route
+{
+    const char *uri;
+    httpd_method_t method;
+    esp_err_t (*handler)(httpd_req_t *req);
+    MetricEndpoint metric;
+};
+
+static const Route ROUTES[] = {
+    {"/status", HTTP_GET, handleStatus, MET_EP_STATUS},
+    {"/health", HTTP_GET, handleHealth, MET_EP_HEALTH},
+    {"/config", HTTP_GET, handleConfigFile, MET_EP_CONFIG},
+    {"/config.json", HTTP_GET, handleConfigFile, MET_EP_CONFIG},
+    {"/config", HTTP_HEAD, handleConfigFile, MET_EP_CONFIG_HEAD},
+    {"/config.json", HTTP_HEAD, handleConfigFile, MET_EP_CONFIG_HEAD},
+    {"/files/*", HTTP_GET, handleFilesDownload, MET_EP_FILES},
+    {"/files/*", HTTP_HEAD, handleFilesDownload, MET_EP_FILES_HEAD},
+    {"/config", HTTP_PATCH, handlePatchConfig, MET_EP_CONFIG_PATCH},
+    {"/logs", HTTP_GET, handleLogs, MET_EP_LOGS},
+    {"/metrics", HTTP_GET, handleMetrics, MET_EP_METRICS},
+    {"/events", HTTP_GET, handleEvents, MET_EP_EVENTS},
+#if TB_PROFILE
+    {"/profile", HTTP_GET, handleProfile, MET_EP_PROFILE},
+    {"/profile/reset", HTTP_POST, handleProfileReset, MET_EP_COUNT}, // not timed
+#endif
+#ifdef TB_UI_STRESS
+    {"/debug/ui-stress", HTTP_POST, handleUiStress, MET_EP_COUNT}, // not timed
+#endif
+};
+
+static const size_t ROUTE_COUNT = sizeof(ROUTES) / sizeof(ROUTES[0]);
+// Profiler scope of each route, registered by startStatusServer().
+static uint8_t routeProfile[ROUTE_COUNT];
+
+// Profiler group for a route's method, so GET and PATCH /config stay apart.
+static const char *profileGroup(httpd_method_t method)
+{
+    switch (method)
+    {
+    case HTTP_GET:
+        return "http GET";
+    case HTTP_HEAD:
+        return "http HEAD";
+    case HTTP_POST:
+        return "http POST";
+    case HTTP_PATCH:
+        return "http PATCH";
+    default:
+        return "http";
+    }
+}
+
+// Every route is registered through this wrapper (user_ctx is the Route), so
+// handlers stay unaware of the latency histograms and the profiler.
+static esp_err_t dispatchTimed(httpd_req_t *req)
+{
+    const Route *route = static_cast<const Route *>(req->user_ctx);
+    touchSession(httpd_req_to_sockfd(req));
+    uint32_t start = micros();
+    esp_err_t err;
+    {
+        ProfileScope scope(routeProfile[route - ROUTES]);
+        err = route->handler(req);
+    }
+    metricsObserveRequest(route->metric, micros() - start);
+    return err;
+}
+
+bool startStatusServer()
+{
+    if (httpd)
+        return true;
+
+    httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+    config.server_port = 80;
+    config.max_open_sockets = MAX_OPEN_SOCKETS;
+    config.lru_purge_enable = false; // onSocketOpen() purges, sparing /events
+    config.backlog_conn = 8;
+    config.max_uri_handlers = ROUTE_COUNT;
+    config.uri_match_fn = httpd_uri_match_wildcard; // for /files/*
+    // PATCH /config holds the patch body plus saveConfig()'s JSON buffer on
+    // the stack; file downloads hold a FILE_STREAM_BLOCK buffer.
+    config.stack_size = 8192;
+    config.core_id = NET_CORE; // next to lwIP, away from display and sensor work
+    config.open_fn = onSocketOpen;
+    config.close_fn = onSocketClose; // forgets sessions and /events subscribers
+    for (Session &s : sessions)
+        s.fd = -1;
+
+    esp_err_t err = httpd_start(&httpd, &config);
+    if (err != ESP_OK)
+    {
+        Serial.printf("Status server failed to start: %s\n", esp_err_to_name(err));
+        httpd = nullptr;
+        return false;
+    }
+    for (size_t i = 0; i < ROUTE_COUNT; ++i)
+    {
+        routeProfile[i] = profileRegister(profileGroup(ROUTES[i].method), ROUTES[i].uri);
+        httpd_uri_t uri = {};
+        uri.uri = ROUTES[i].uri;
+        uri.method = ROUTES[i].method;
+        uri.handler = dispatchTimed;
+        uri.user_ctx = const_cast<Route *>(&ROUTES[i]);
+        httpd_register_uri_handler(httpd, &uri);
+    }
+    httpd_register_err_handler(httpd, HTTPD_404_NOT_FOUND, handleNotFound);
+    Serial.println("Status server started on port 80");
+    return true;
+}
+
+void stopStatusServer()
+{
+    if (!httpd)
+        return;
+    httpd_stop(httpd);
+    httpd = nullptr;
+    for (size_t i = 0; i < MAX_EVENT_SUBSCRIBERS; ++i)
+        eventFds[i] = -1;
+    for (Session &s : sessions)
+        s.fd = -1;
+    eventSubscribers = 0;
+    pendingLen = 0;
+}
+
+bool isStatusServerRunning() { return httpd != nullptr; }
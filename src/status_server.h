@@ -0,0 +1,25 @@
+// status_server.h
+// STA-mode HTTP server on port 80 (/status, /health, /config, /events, ...).
+// Built on the ESP-IDF esp_http_server component: it runs in its own FreeRTOS
+// task on the net core (cores.h) and keeps several sockets open with HTTP/1.1
+// keep-alive, so neither the UI core nor the net scheduler task has to be
+// reached for a request to be answered.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Start the server; a second call while running is a no-op. Returns false if
+// the httpd task could not be created.
+bool startStatusServer();
+// Stop the server and close all client sockets.
+void stopStatusServer();
+bool isStatusServerRunning();
+
+// GET /events subscribers currently connected; maintained on the httpd task
+// and read by telemetryLoop() on the net task as a hint.
+uint8_t eventSubscriberCount();
+// Queue one pre-formatted SSE frame for every /events subscriber. The frame
+// is copied and sent from the httpd task. Returns false (and sends nothing)
+// while the previous frame is still queued, or if it is too large.
+bool publishEvent(const char *data, size_t len);
@@ -1,23 +1,47 @@
 #include "system.h"
 #include "globals.h"
 #include "led.h"
+#include "logger.h"
+#include "display.h"
+#include "button.h"
+#include "spsc_queue.h"
 #include <Arduino.h>
 
+static bool restartPending = false;
+static unsigned long restartAt = 0;
+
 void systemInit()
 {
     // placeholder for future system-wide initialization
 }
 
+void scheduleRestart(unsigned long delayMs)
+{
+    restartAt = millis() + delayMs;
+    restartPending = true;
+}
+
+void systemLoop()
+{
+    if (restartPending && (long)(millis() - restartAt) >= 0)
+    {
+        Serial.println("Scheduled restart");
+        delay(50);
+        ESP.restart();
+    }
+}
+
 void factoryResetAction()
 {
     Serial.println("Factory reset: clearing stored configuration...");
 
-    // Clear preferences namespace
+    // Clear preferences namespace (this includes the packed config image)
     prefs.begin("thermabridge", false);
     prefs.clear();
     prefs.end();
 
-    // Erase config.json from LittleFS
+    // Erase config.json from LittleFS (and the NVS config image, again, in
+    // case the namespace clear above failed)
     eraseConfig();
 
     // Visual feedback
@@ -28,21 +52,93 @@ void factoryResetAction()
     ESP.restart();
 }
 
-bool checkFactoryReset()
+// Holding BOOT at least this long, but releasing it before the factory-reset
+// threshold, requests the provisioning AP (see takeApRequest()).
+static const unsigned long AP_GESTURE_MS = 3000;
+
+// BOOT button requests from the UI core (buttonTask()) to the net core (the
+// Wi-Fi link supervisor).
+enum class ButtonRequest : uint8_t
+{
+    ApRequest,
+};
+static SpscQueue<ButtonRequest, 4> buttonRequests;
+
+// GPIO0, active-low; sampled by buttonTask().
+static ButtonGestures bootButton(10000);
+// The LED colour shown for the current hold, or -1 when none is shown.
+static int8_t ledHoldShown = -1;
+
+// uiCfg is set as soon as the config loads (tryLoadConfig()); it is all zero
+// in a provisioning-only boot, which gets the schema default.
+static uint32_t resetHoldMs()
+{
+    return (uiCfg.reset_hold_seconds > 0 ? uiCfg.reset_hold_seconds : 10) * 1000UL;
+}
+
+static void showHoldProgress(uint32_t now)
 {
-    uint16_t holdSecs = (cfg.reset_hold_seconds > 0) ? cfg.reset_hold_seconds : 10;
-    if (digitalRead(0) == LOW)
+    uint32_t held = bootButton.heldMs(now);
+    int8_t apArmed = held >= AP_GESTURE_MS ? 1 : 0;
+    if (apArmed != ledHoldShown)
     {
-        unsigned long start = millis();
-        while (digitalRead(0) == LOW)
+        ledShowHold(apArmed);
+        ledHoldShown = apArmed;
+    }
+    displayShowHold(held, AP_GESTURE_MS, bootButton.longHold());
+}
+
+static void endHoldProgress()
+{
+    ledEndHold();
+    ledHoldShown = -1;
+    displayEndHold();
+}
+
+void buttonTask()
+{
+    uint32_t now = millis();
+    bootButton.setLongHoldMs(resetHoldMs());
+    bootButton.update(digitalRead(0) == LOW, now);
+
+    ButtonEvent ev;
+    while (bootButton.poll(ev))
+    {
+        switch (ev.gesture)
         {
-            if (millis() - start >= (unsigned long)holdSecs * 1000UL)
+        case ButtonGesture::Press:
+        case ButtonGesture::DoublePress:
+            displayOnButton(ev.gesture);
+            break;
+        case ButtonGesture::HoldStart:
+            LOG_I("BOOT: held; release after %lu s for the AP, hold %lu s to reset",
+                  AP_GESTURE_MS / 1000, (unsigned long)bootButton.longHold() / 1000);
+            break;
+        case ButtonGesture::LongHold:
+            factoryResetAction(); // does not return
+            break;
+        case ButtonGesture::HoldEnd:
+            endHoldProgress();
+            // A shorter hold (but still deliberate) asks for the provisioning AP.
+            if (ev.heldMs >= AP_GESTURE_MS)
             {
-                factoryResetAction();
-                return true;
+                LOG_I("BOOT: released after %lu ms, requesting the AP", (unsigned long)ev.heldMs);
+                buttonRequests.push(ButtonRequest::ApRequest);
             }
-            delay(200);
+            break;
         }
     }
+    if (bootButton.holding())
+        showHoldProgress(now);
+}
+
+bool takeApRequest()
+{
+    ButtonRequest req;
+    while (buttonRequests.pop(req))
+    {
+        if (req == ButtonRequest::ApRequest)
+            return true;
+    }
     return false;
 }
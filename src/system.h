@@ -4,5 +4,17 @@
 #include <stdbool.h>
 
 void systemInit();
-bool checkFactoryReset();
+// Scheduler task (UI core), every BUTTON_POLL_MS: samples the BOOT button
+// into its gesture recognizer (button.h) and acts on the gestures. Never
+// blocks; holding for reset_hold_seconds wipes the config and restarts
+// (factoryResetAction()), and the hold progress is shown on the LED and OLED.
+void buttonTask();
+// Net core. True once after BOOT was held for 3 s and released before the
+// reset threshold; the Wi-Fi link supervisor opens the provisioning AP on it.
+bool takeApRequest();
 void factoryResetAction();
+// Restart the device after delayMs without blocking the caller, e.g. so an
+// HTTP response can be flushed first. Serviced by systemLoop().
+void scheduleRestart(unsigned long delayMs);
+// Scheduler task (net core): performs a scheduled restart once it is due.
+void systemLoop();
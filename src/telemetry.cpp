@@ -0,0 +1,204 @@
+#include "telemetry.h"
+#include "json_writer.h"
+#include "status_server.h"
+#include "sensors.h"
+#include <Arduino.h>
+#include <WiFi.h>
+
+// Marks a climate reading that is unavailable (no sensor, or a failed read).
+static const int16_t NO_READING = INT16_MIN;
+
+// Changes smaller than these are noise and do not trigger an event.
+static const int RSSI_HYSTERESIS_DB = 3;
+static const uint32_t HEAP_HYSTERESIS_BYTES = 1024;
+
+// Climate values are kept in tenths so equal readings compare equal.
+struct Sample
+{
+    int16_t tempDeciF;
+    int16_t humidityDeci;
+    int16_t pressureDeciHpa;
+    int8_t wifiStatus;
+    int8_t rssi;
+    uint32_t ip;
+    uint32_t freeHeap;
+};
+
+enum SampleField : uint8_t
+{
+    F_CLIMATE = 1 << 0,
+    F_WIFI = 1 << 1, // status and IP
+    F_RSSI = 1 << 2,
+    F_HEAP = 1 << 3,
+    F_ALL = 0xFF,
+};
+
+// Last published sample; read by the httpd task for snapshots.
+static Sample published = {NO_READING, NO_READING, NO_READING, 0, 0, 0, 0};
+static portMUX_TYPE publishedMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Net-task state (telemetryLoop() on the net scheduler, core 0).
+static Sample current = published;
+static unsigned long lastSample = 0;
+static unsigned long lastClimate = 0;
+static unsigned long lastSent = 0;
+static uint8_t lastSubscribers = 0;
+
+static int16_t toDeci(float v)
+{
+    if (isnan(v) || v > 3000.0F || v < -3000.0F)
+        return NO_READING;
+    return (int16_t)lroundf(v * 10.0F);
+}
+
+static void applyClimate(Sample &s, const ClimateReading &r)
+{
+    s.tempDeciF = toDeci(r.tempF);
+    s.humidityDeci = toDeci(r.humidity);
+    s.pressureDeciHpa = toDeci(r.pressureHpa);
+}
+
+static void readSystem(Sample &s)
+{
+    s.wifiStatus = (int8_t)WiFi.status();
+    bool up = s.wifiStatus == WL_CONNECTED;
+    s.ip = up ? (uint32_t)WiFi.localIP() : 0;
+    s.rssi = up ? (int8_t)WiFi.RSSI() : 0;
+    s.freeHeap = ESP.getFreeHeap();
+}
+
+static uint8_t diff(const Sample &a, const Sample &b)
+{
+    uint8_t m = 0;
+    if (a.tempDeciF != b.tempDeciF || a.humidityDeci != b.humidityDeci || a.pressureDeciHpa != b.pressureDeciHpa)
+        m |= F_CLIMATE;
+    if (a.wifiStatus != b.wifiStatus || a.ip != b.ip)
+        m |= F_WIFI;
+    if (abs(a.rssi - b.rssi) >= RSSI_HYSTERESIS_DB)
+        m |= F_RSSI;
+    uint32_t heapDelta = a.freeHeap > b.freeHeap ? a.freeHeap - b.freeHeap : b.freeHeap - a.freeHeap;
+    if (heapDelta >= HEAP_HYSTERESIS_BYTES)
+        m |= F_HEAP;
+    return m;
+}
+
+// A tenths value as a JSON number, or null.
+static void writeDeci(JsonWriter &w, const char *key, int16_t v)
+{
+    w.key(key);
+    if (v == NO_READING)
+    {
+        w.null();
+        return;
+    }
+    char num[8];
+    snprintf(num, sizeof(num), "%s%d.%d", v < 0 ? "-" : "", abs(v) / 10, abs(v) % 10);
+    w.raw(num);
+}
+
+// One SSE frame: "event: <type>\ndata: {...}\n\n". Returns its length or 0.
+static size_t formatEvent(char *buf, size_t cap, const char *type, const Sample &s, uint8_t fields)
+{
+    int head = snprintf(buf, cap, "event: %s\ndata: ", type);
+    if (head < 0 || (size_t)head + 3 > cap)
+        return 0;
+    JsonWriter w(buf + head, cap - head - 2); // keep room for the blank line
+    w.beginObject();
+    w.key("uptime_s").num(millis() / 1000UL);
+    if (fields & F_CLIMATE)
+    {
+        writeDeci(w, "temp_f", s.tempDeciF);
+        writeDeci(w, "humidity", s.humidityDeci);
+        writeDeci(w, "pressure_hpa", s.pressureDeciHpa);
+    }
+    if (fields & F_WIFI)
+    {
+        char ip[16];
+        snprintf(ip, sizeof(ip), "%u.%u.%u.%u", (unsigned)(s.ip & 0xFF), (unsigned)((s.ip >> 8) & 0xFF),
+                 (unsigned)((s.ip >> 16) & 0xFF), (unsigned)(s.ip >> 24));
+        w.key("wifi_status").numSigned(s.wifiStatus);
+        w.key("ip").str(ip);
+    }
+    if (fields & F_RSSI)
+        w.key("rssi").numSigned(s.rssi);
+    if (fields & F_HEAP)
+        w.key("free_heap").num(s.freeHeap);
+    w.endObject();
+    size_t len = w.finish();
+    if (len == 0)
+        return 0;
+    memcpy(buf + head + len, "\n\n", 2);
+    return head + len + 2;
+}
+
+size_t telemetryFormatSnapshot(char *buf, size_t cap)
+{
+    Sample s;
+    portENTER_CRITICAL(&publishedMux);
+    s = published;
+    portEXIT_CRITICAL(&publishedMux);
+    return formatEvent(buf, cap, "snapshot", s, F_ALL);
+}
+
+void telemetryLoop()
+{
+    // Drained even without subscribers so a new one never gets a stale
+    // reading that sat in the queue.
+    ClimateReading reading;
+    bool haveReading = sensorsTakeReading(reading);
+
+    uint8_t subscribers = eventSubscriberCount();
+    bool joined = subscribers > lastSubscribers;
+    lastSubscribers = subscribers;
+    if (subscribers == 0)
+        return; // nobody listening: no sensor reads, no serialization
+
+    unsigned long now = millis();
+    // The sensors sit on the UI core's I2C bus: ask for a reading there and
+    // pick it up from the queue on a later pass.
+    if (joined || lastClimate == 0 || now - lastClimate >= TELEMETRY_CLIMATE_MS)
+    {
+        sensorsRequestReading();
+        lastClimate = now;
+    }
+    // A new subscriber got the last published state as its snapshot; sample
+    // right away so a stale one is corrected within a pass. A fresh climate
+    // reading goes out as soon as it arrives.
+    if (!joined && !haveReading && now - lastSample < TELEMETRY_PERIOD_MS)
+        return;
+    lastSample = now;
+
+    Sample next = current;
+    readSystem(next);
+    if (haveReading)
+        applyClimate(next, reading);
+
+    char buf[TELEMETRY_EVENT_MAX];
+    uint8_t fields = diff(current, next);
+    if (fields)
+    {
+        size_t len = formatEvent(buf, sizeof(buf), "update", next, fields);
+        // If the previous event has not gone out yet, keep the old baseline;
+        // the next pass then sends the accumulated change.
+        if (len && publishEvent(buf, len))
+        {
+            // Fields below the hysteresis keep their last published value so
+            // slow drift still adds up to an event eventually.
+            if (!(fields & F_RSSI))
+                next.rssi = current.rssi;
+            if (!(fields & F_HEAP))
+                next.freeHeap = current.freeHeap;
+            current = next;
+            portENTER_CRITICAL(&publishedMux);
+            published = current;
+            portEXIT_CRITICAL(&publishedMux);
+            lastSent = now;
+        }
+    }
+    else if (now - lastSent >= TELEMETRY_KEEPALIVE_MS)
+    {
+        static const char KEEPALIVE[] = ": keep-alive\n\n";
+        if (publishEvent(KEEPALIVE, sizeof(KEEPALIVE) - 1))
+            lastSent = now;
+    }
+}
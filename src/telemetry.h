@@ -0,0 +1,29 @@
+// telemetry.h
+// Live readings pushed to GET /events subscribers as Server-Sent Events.
+// telemetryLoop() samples on the net core while someone is subscribed, compares
+// against the last published values and, only when something changed,
+// serializes one delta event that the STA server fans out to every
+// subscriber. Deltas carry absolute values, so a late or repeated one is
+// harmless.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// How often Wi-Fi state and heap are checked for changes.
+static const uint32_t TELEMETRY_PERIOD_MS = 1000;
+// How often a climate reading is requested from the UI core (sensors.h); an
+// AHT20 conversion blocks that core for ~80 ms, so this is deliberately
+// slower than the rest.
+static const uint32_t TELEMETRY_CLIMATE_MS = 10000;
+// A comment line is sent when nothing else was for this long, so proxies
+// keep the stream open and dead subscribers are noticed.
+static const uint32_t TELEMETRY_KEEPALIVE_MS = 15000;
+// Largest serialized event, including the SSE framing.
+static const size_t TELEMETRY_EVENT_MAX = 256;
+
+void telemetryLoop();
+
+// Format the full last-published state as an "event: snapshot" SSE frame.
+// Called from the httpd task for a new subscriber. Returns the length, or 0.
+size_t telemetryFormatSnapshot(char *buf, size_t cap);
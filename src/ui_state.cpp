@@ -0,0 +1,151 @@
+#include "ui_state.h"
+
+static const char *const MENU_LABELS[UI_MENU_COUNT] = {"Status", "Config", "Climate", "Reboot"};
+
+const char *uiMenuLabel(uint8_t item)
+{
+    return item < UI_MENU_COUNT ? MENU_LABELS[item] : "";
+}
+
+void UiStateMachine::begin(bool hasEncoder, UiScreen first, uint32_t nowMs)
+{
+    encoder = hasEncoder;
+    cursor = 0;
+    lastInput = nowMs;
+    enter(first, nowMs);
+}
+
+void UiStateMachine::enter(UiScreen s, uint32_t nowMs)
+{
+    current = s;
+    enteredAt = nowMs;
+    refreshedAt = nowMs;
+    step = 0;
+    dirty = true;
+    sampleDue = false;
+}
+
+void UiStateMachine::moveCursor(int delta)
+{
+    int i = (cursor + delta) % UI_MENU_COUNT;
+    if (i < 0)
+        i += UI_MENU_COUNT;
+    cursor = (uint8_t)i;
+}
+
+void UiStateMachine::turn(int delta, uint32_t nowMs)
+{
+    if (delta == 0)
+        return;
+    lastInput = nowMs;
+    switch (current)
+    {
+    case UiScreen::Splash:
+    case UiScreen::Screensaver:
+        enter(UiScreen::Menu, nowMs); // the waking turn does not move the cursor
+        break;
+    case UiScreen::Menu:
+        moveCursor(delta);
+        break;
+    default:
+        moveCursor(delta);
+        enter(UiScreen::Menu, nowMs);
+        break;
+    }
+}
+
+UiAction UiStateMachine::select(uint32_t nowMs)
+{
+    lastInput = nowMs;
+    if (current != UiScreen::Menu)
+    {
+        enter(UiScreen::Menu, nowMs);
+        return UiAction::None;
+    }
+    switch (cursor)
+    {
+    case 0:
+        enter(UiScreen::Status, nowMs);
+        break;
+    case 1:
+        enter(UiScreen::Config, nowMs);
+        break;
+    case 2:
+        enter(UiScreen::Climate, nowMs);
+        break;
+    default:
+        return UiAction::Reboot;
+    }
+    return UiAction::None;
+}
+
+void UiStateMachine::button(ButtonGesture gesture, uint32_t nowMs)
+{
+    if (gesture != ButtonGesture::Press && gesture != ButtonGesture::DoublePress)
+        return;
+    lastInput = nowMs;
+    // Without an encoder this redraws the status screen that is already up.
+    enter(gesture == ButtonGesture::Press ? home() : UiScreen::Status, nowMs);
+}
+
+void UiStateMachine::activity(uint32_t nowMs)
+{
+    lastInput = nowMs;
+    if (current == UiScreen::Screensaver)
+        enter(home(), nowMs);
+}
+
+void UiStateMachine::tick(uint32_t nowMs)
+{
+    switch (current)
+    {
+    case UiScreen::Splash:
+        if (!encoder && nowMs - enteredAt >= UI_SPLASH_MS)
+            enter(UiScreen::Status, nowMs);
+        else if (encoder && nowMs - lastInput >= UI_IDLE_MS)
+            enter(UiScreen::Screensaver, nowMs);
+        return;
+    case UiScreen::Screensaver:
+        if (nowMs - refreshedAt >= UI_SAVER_STEP_MS)
+        {
+            refreshedAt = nowMs;
+            step++;
+            dirty = true;
+        }
+        return;
+    default:
+        break;
+    }
+
+    // Without an encoder nothing could wake the screensaver but BOOT, so the
+    // status screen just stays up.
+    if (encoder && nowMs - lastInput >= UI_IDLE_MS)
+    {
+        enter(UiScreen::Screensaver, nowMs);
+        return;
+    }
+    if (encoder && current != UiScreen::Menu && nowMs - lastInput >= UI_DETAIL_MS)
+    {
+        enter(UiScreen::Menu, nowMs);
+        return;
+    }
+    if (current == UiScreen::Climate && nowMs - refreshedAt >= UI_CLIMATE_REFRESH_MS)
+    {
+        refreshedAt = nowMs;
+        sampleDue = true;
+    }
+}
+
+bool UiStateMachine::takeRedraw()
+{
+    bool d = dirty;
+    dirty = false;
+    return d;
+}
+
+bool UiStateMachine::takeSample()
+{
+    bool d = sampleDue;
+    sampleDue = false;
+    return d;
+}
@@ -0,0 +1,105 @@
+// ui_state.h
+// OLED screen state machine: which screen is up, the menu cursor, and when
+// the screen has to be composed again. It is driven by input events and a
+// millisecond clock and never waits or touches the panel, so displayLoop()
+// returns right away on a device nobody touches, and the transitions can be
+// stepped on a host with a fake clock.
+//
+//   Splash       boot; the first encoder input (consumed) opens the menu.
+//                Without an encoder the status screen follows after
+//                UI_SPLASH_MS.
+//   Menu         turn moves the cursor, press opens the item
+//   Status,      turn returns to the menu with the cursor moved, press
+//   Config,      returns to it as is, and so does UI_DETAIL_MS without
+//   Climate      input (encoder only); Climate asks for a new reading every
+//                UI_CLIMATE_REFRESH_MS
+//   Screensaver  after UI_IDLE_MS without input (encoder only); the next
+//                input (consumed) opens the menu
+//
+// BOOT Press opens the menu (the status screen without an encoder),
+// DoublePress the status screen, from any state.
+#pragma once
+
+#include <stdint.h>
+#include "button.h"
+
+// Boot splash without an encoder, before the status screen.
+static const uint32_t UI_SPLASH_MS = 3000;
+// Encoder idle time before a detail screen goes back to the menu, and
+// before the screensaver. Both count from the last input.
+static const uint32_t UI_DETAIL_MS = 20000;
+static const uint32_t UI_IDLE_MS = 30000;
+// How often the screensaver moves its text, against burn-in.
+static const uint32_t UI_SAVER_STEP_MS = 5000;
+// New reading on the climate screen. A climate read blocks the UI core for
+// ~80 ms on an AHT20, so it is not polled like the rest of the bound data.
+static const uint32_t UI_CLIMATE_REFRESH_MS = 10000;
+
+enum class UiScreen : uint8_t
+{
+    Splash,
+    Menu,
+    Status,
+    Config,
+    Climate,
+    Screensaver,
+};
+
+// What the caller has to do besides drawing.
+enum class UiAction : uint8_t
+{
+    None,
+    Reboot,
+};
+
+// Menu entries, in order: Status, Config, Climate, Reboot.
+static const uint8_t UI_MENU_COUNT = 4;
+const char *uiMenuLabel(uint8_t item);
+
+class UiStateMachine
+{
+public:
+    // Start over on `first`; timers count from nowMs.
+    void begin(bool hasEncoder, UiScreen first, uint32_t nowMs);
+
+    // Encoder input, in the order it happened.
+    void turn(int delta, uint32_t nowMs);
+    UiAction select(uint32_t nowMs);
+    // BOOT Press and DoublePress; other gestures are ignored.
+    void button(ButtonGesture gesture, uint32_t nowMs);
+    // Someone is at the device without using the encoder (e.g. holding
+    // BOOT): restart the idle timer and leave the screensaver.
+    void activity(uint32_t nowMs);
+    // Timers: splash and detail screen timeouts, screensaver, climate
+    // refresh. Timestamps must not go backwards.
+    void tick(uint32_t nowMs);
+
+    // Something else drew over the panel; compose screen() again.
+    void invalidate() { dirty = true; }
+    // True once per change: screen() must be composed from scratch (entered,
+    // invalidated, screensaver step). What a screen shows, the menu cursor
+    // included, is bound data and does not set this (widgets.h).
+    bool takeRedraw();
+    // True once every UI_CLIMATE_REFRESH_MS on the climate screen.
+    bool takeSample();
+
+    UiScreen screen() const { return current; }
+    UiScreen home() const { return encoder ? UiScreen::Menu : UiScreen::Status; }
+    uint8_t menuIndex() const { return cursor; }
+    // Screensaver position; advances every UI_SAVER_STEP_MS.
+    uint32_t saverStep() const { return step; }
+
+private:
+    void enter(UiScreen s, uint32_t nowMs);
+    void moveCursor(int delta);
+
+    bool encoder = false;
+    UiScreen current = UiScreen::Splash;
+    uint8_t cursor = 0;
+    uint32_t enteredAt = 0;
+    uint32_t lastInput = 0;
+    uint32_t refreshedAt = 0; // last climate refresh or screensaver step
+    uint32_t step = 0;
+    bool dirty = true;
+    bool sampleDue = false;
+};
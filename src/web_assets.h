@@ -0,0 +1,179 @@
+// web_assets.h
+// Generated by scripts/embed_assets.py from data/. Do not edit.
+#pragma once
+
+#include <Arduino.h>
+
+struct WebAsset
+{
+    const char *path;        // request path
+    const char *contentType;
+    const char *etag;        // strong ETag, quoted
+    bool immutable;          // referenced with ?v=<etag>; safe to cache long-term
+    const uint8_t *gz;       // gzip-compressed body in flash
+    size_t gzLen;
+};
+
+// index.html: 1649 bytes minified, 775 gzipped
+static const uint8_t WEB_ASSET_0[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x55, 0x6d, 0x6f, 0xdb, 0x36,
+    0x10, 0xfe, 0xee, 0x5f, 0x71, 0xe5, 0x87, 0xa2, 0x05, 0x1a, 0x4b, 0x6e, 0x96, 0xad, 0x29, 0x24,
+    0x15, 0x6d, 0x8c, 0xae, 0x01, 0xda, 0x26, 0x98, 0x83, 0xed, 0x63, 0x70, 0x16, 0x4f, 0x36, 0x17,
+    0x8a, 0xd4, 0x48, 0x4a, 0x99, 0xfe, 0xfd, 0x8e, 0x7a, 0x49, 0xbc, 0xb8, 0x68, 0xfb, 0xc1, 0x20,
+    0x75, 0x2f, 0xcf, 0xf3, 0x1c, 0xef, 0x48, 0x67, 0xcf, 0xa4, 0x2d, 0x43, 0xdf, 0x10, 0xec, 0x43,
+    0xad, 0x8b, 0x45, 0x36, 0x2f, 0x84, 0x92, 0x97, 0x9a, 0x02, 0x82, 0xc1, 0x9a, 0x72, 0xd1, 0x29,
+    0xba, 0x6f, 0xac, 0x0b, 0x02, 0x4a, 0x6b, 0x02, 0x99, 0x90, 0x8b, 0x7b, 0x25, 0xc3, 0x3e, 0x97,
+    0xd4, 0xa9, 0x92, 0x4e, 0x86, 0x8f, 0x57, 0xa0, 0x8c, 0x0a, 0x0a, 0xf5, 0x89, 0x2f, 0x51, 0x53,
+    0xbe, 0x12, 0x0c, 0x12, 0x54, 0xd0, 0x54, 0xdc, 0xec, 0xc9, 0xd5, 0xf8, 0xc1, 0x29, 0xb9, 0x23,
+    0xb8, 0x76, 0xb6, 0x53, 0x5e, 0x59, 0xa3, 0xcc, 0x2e, 0x4b, 0xc6, 0x80, 0x45, 0xa6, 0x95, 0xb9,
+    0x03, 0x47, 0x3a, 0x17, 0x3e, 0xf4, 0x9a, 0xfc, 0x9e, 0x88, 0xe9, 0xf6, 0x8e, 0xaa, 0x5c, 0x24,
+    0x83, 0x69, 0x59, 0x7a, 0xff, 0xae, 0xcb, 0x4f, 0xf1, 0xf5, 0xd9, 0xea, 0x97, 0x6a, 0x9b, 0x62,
+    0x8a, 0xe5, 0x9b, 0x5f, 0x29, 0xb2, 0x24, 0x93, 0xe4, 0xad, 0x95, 0x7d, 0x2c, 0xe0, 0xf4, 0x7b,
+    0x8c, 0xec, 0x5d, 0x64, 0x95, 0x75, 0x35, 0x28, 0x99, 0x8b, 0x86, 0x7d, 0x11, 0x42, 0xe3, 0x96,
+    0x74, 0xf1, 0x97, 0x3a, 0xf9, 0xa8, 0x60, 0xb3, 0xb9, 0x5c, 0x67, 0xca, 0x34, 0x6d, 0x18, 0x42,
+    0xbc, 0x57, 0x52, 0x4c, 0x27, 0x31, 0xee, 0xb5, 0xf2, 0x7c, 0x04, 0x86, 0xc2, 0xbd, 0x75, 0x77,
+    0x5e, 0x00, 0xb6, 0xc1, 0x96, 0xb6, 0x6e, 0x34, 0x05, 0x8e, 0xb1, 0x55, 0x25, 0xb8, 0x94, 0x7f,
+    0x5a, 0xe5, 0x48, 0x16, 0x59, 0x32, 0x42, 0x2f, 0x32, 0x89, 0x01, 0x63, 0xe6, 0x00, 0xfa, 0x90,
+    0xcc, 0x01, 0xb3, 0xe3, 0x89, 0x8c, 0x6b, 0xf4, 0x9e, 0x63, 0xe4, 0x81, 0x94, 0xc6, 0xdf, 0xcd,
+    0x4a, 0x86, 0x6d, 0xec, 0x1e, 0x6f, 0xa7, 0x40, 0x71, 0x40, 0x36, 0xae, 0xeb, 0xa1, 0x3f, 0xf0,
+    0x95, 0x33, 0x0e, 0x50, 0xb8, 0x6b, 0x11, 0x63, 0x46, 0x9a, 0x3f, 0x8f, 0xb2, 0xaf, 0x6e, 0xde,
+    0x7f, 0x4b, 0x84, 0x0d, 0x78, 0xfb, 0x40, 0x39, 0x61, 0xfc, 0xdf, 0xf6, 0x23, 0x59, 0x7f, 0x90,
+    0xa7, 0x00, 0x9f, 0xac, 0x96, 0xb0, 0x21, 0x1e, 0x29, 0xe9, 0x0f, 0xe0, 0x5d, 0x74, 0xde, 0xee,
+    0xd9, 0x79, 0xeb, 0x47, 0xe7, 0x4c, 0xf2, 0x2d, 0xcf, 0x48, 0x65, 0xda, 0x7a, 0x4b, 0x4e, 0x40,
+    0xad, 0x4c, 0x2e, 0x56, 0x62, 0x51, 0xe3, 0xbf, 0xb9, 0x38, 0x4d, 0x53, 0x01, 0x1d, 0xea, 0x96,
+    0x03, 0x56, 0xe9, 0xa1, 0x0a, 0xa9, 0xba, 0x47, 0xaa, 0x4b, 0x53, 0x59, 0x51, 0x5c, 0xb4, 0xce,
+    0xf1, 0x60, 0x03, 0x55, 0x15, 0x95, 0x41, 0x75, 0x04, 0x83, 0x13, 0x22, 0x1b, 0x4c, 0x6c, 0x6f,
+    0x21, 0xf3, 0x0d, 0x9a, 0xc7, 0xd4, 0xb5, 0xf2, 0x8d, 0xc6, 0x5e, 0x14, 0xab, 0x34, 0x4b, 0xa2,
+    0xab, 0xf0, 0xdc, 0x4d, 0xd5, 0x31, 0x45, 0x03, 0xa5, 0xe6, 0xfa, 0x73, 0xb1, 0x57, 0x26, 0x88,
+    0x62, 0xa8, 0x35, 0xec, 0x09, 0x3e, 0x5c, 0x5d, 0xdd, 0xc0, 0xb6, 0x0d, 0xc1, 0x1a, 0xe0, 0x21,
+    0x64, 0x9b, 0xf2, 0x50, 0xa3, 0xe9, 0x67, 0x12, 0x08, 0x16, 0x82, 0x53, 0xbb, 0x1d, 0x39, 0x40,
+    0xa8, 0xb0, 0x0c, 0xd6, 0xf5, 0x93, 0x98, 0x17, 0x92, 0x2a, 0x6c, 0x75, 0x80, 0x55, 0xea, 0x5f,
+    0x2e, 0xe1, 0x4f, 0x9e, 0x1a, 0xb9, 0x70, 0x68, 0x76, 0xf4, 0x16, 0x56, 0x27, 0x5c, 0xaf, 0x5f,
+    0x66, 0x49, 0x13, 0x0b, 0xe4, 0xbb, 0xab, 0xb4, 0xe7, 0x9d, 0x6f, 0xeb, 0x1a, 0x5d, 0x5f, 0x6c,
+    0x02, 0x06, 0x55, 0xc2, 0xe5, 0x35, 0xbc, 0xb0, 0x4d, 0xe0, 0xbb, 0x80, 0xfa, 0x25, 0x6b, 0x9e,
+    0xbc, 0x47, 0x7a, 0x3f, 0x13, 0xf2, 0x11, 0x50, 0xdd, 0x84, 0x3e, 0x0a, 0x6a, 0x3d, 0xc1, 0xfa,
+    0xd3, 0xc5, 0xf5, 0x12, 0x36, 0xed, 0x96, 0x47, 0x17, 0x26, 0x21, 0x83, 0xda, 0xd7, 0x67, 0x67,
+    0xcb, 0xf9, 0x97, 0xbe, 0x82, 0xf5, 0xd7, 0xcd, 0x50, 0x03, 0x17, 0xbb, 0xc3, 0x40, 0xf7, 0xd8,
+    0x4f, 0xa2, 0xc6, 0xd3, 0x67, 0x05, 0xef, 0xa5, 0xe4, 0x7a, 0x0e, 0x7b, 0xee, 0x07, 0x75, 0xb7,
+    0xaa, 0x79, 0xb8, 0x67, 0x8f, 0x86, 0x21, 0xaa, 0xb6, 0x72, 0x98, 0xd4, 0x52, 0xd5, 0xa8, 0x8f,
+    0x07, 0xea, 0xf7, 0x91, 0xe8, 0x18, 0x71, 0x52, 0xf0, 0x04, 0xf6, 0xc1, 0xfa, 0x33, 0xd8, 0x53,
+    0xc5, 0x5f, 0xd0, 0xdf, 0x1d, 0xe3, 0xfb, 0xc1, 0xf9, 0x04, 0x7e, 0x36, 0xfe, 0x0c, 0x7a, 0x3c,
+    0xad, 0x0d, 0xb9, 0x8e, 0xdc, 0x31, 0xb8, 0x34, 0xfe, 0x09, 0xf2, 0x60, 0xf9, 0x3e, 0x6c, 0xf2,
+    0xd8, 0xfb, 0x69, 0xcc, 0xc6, 0x2b, 0xc2, 0xa2, 0x6a, 0xc5, 0x9d, 0xdd, 0xc4, 0xc6, 0x3e, 0x87,
+    0x0b, 0x6b, 0x0c, 0x0f, 0x7a, 0x96, 0x8c, 0x41, 0x31, 0x31, 0xbe, 0x89, 0x07, 0x97, 0x23, 0x52,
+    0xb6, 0xe3, 0xfb, 0x34, 0x4c, 0xb4, 0x2f, 0x9d, 0x6a, 0x02, 0x78, 0x57, 0xf2, 0x8b, 0x8c, 0x4d,
+    0xb3, 0xfc, 0x3b, 0x3e, 0xc7, 0x67, 0xb8, 0x2d, 0x71, 0x75, 0x5a, 0xa6, 0xdb, 0xf4, 0x5c, 0x9e,
+    0x9f, 0xff, 0x16, 0xe3, 0xc7, 0xc8, 0x08, 0x39, 0x3d, 0xc8, 0xc9, 0xf8, 0xcf, 0xf2, 0x1f, 0x1f,
+    0xe5, 0x4a, 0x43, 0x71, 0x06, 0x00, 0x00,
+};
+
+// app.js: 3591 bytes minified, 1347 gzipped
+static const uint8_t WEB_ASSET_1[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x57, 0x4b, 0x6f, 0xdb, 0x46,
+    0x10, 0xbe, 0xeb, 0x57, 0x4c, 0x2f, 0x21, 0x89, 0xc8, 0xb4, 0xdd, 0x5c, 0x0a, 0xab, 0x4e, 0x91,
+    0x67, 0x11, 0x20, 0x4d, 0x8d, 0xd8, 0x3d, 0x05, 0x81, 0xb1, 0xe2, 0x8e, 0x44, 0xd6, 0xcb, 0x5d,
+    0x62, 0x77, 0x49, 0x45, 0x70, 0xfc, 0xdf, 0x3b, 0xb3, 0x7c, 0xe8, 0x49, 0x25, 0xe8, 0xc5, 0x96,
+    0x66, 0xe7, 0xf1, 0xcd, 0xcc, 0x37, 0xb3, 0x2b, 0x69, 0xb2, 0xba, 0x44, 0xed, 0xd3, 0x25, 0xfa,
+    0x77, 0x0a, 0xf9, 0xe3, 0xeb, 0xf5, 0x07, 0x19, 0x47, 0x95, 0x35, 0x4d, 0x94, 0xa4, 0x42, 0xca,
+    0x77, 0x0d, 0x09, 0x3f, 0x16, 0xce, 0xa3, 0x46, 0x1b, 0x47, 0xae, 0x9e, 0x97, 0x85, 0x8f, 0xa6,
+    0x20, 0xdc, 0x5a, 0x67, 0xb0, 0xa8, 0x75, 0xe6, 0x0b, 0xa3, 0x63, 0x4c, 0x1e, 0x27, 0x98, 0x56,
+    0x16, 0x59, 0xfd, 0x2d, 0x2e, 0x44, 0xad, 0x7c, 0x9c, 0xcc, 0x26, 0x99, 0xd1, 0xce, 0xc3, 0xc2,
+    0xd8, 0x12, 0xae, 0x01, 0x53, 0x2f, 0x2c, 0x85, 0xea, 0xc5, 0x52, 0x78, 0x41, 0x62, 0x8d, 0x2b,
+    0xf8, 0xe7, 0xf3, 0xc7, 0x5b, 0x14, 0x36, 0xcb, 0x6f, 0x84, 0x15, 0xa5, 0x8b, 0x59, 0xf6, 0x9e,
+    0xac, 0xde, 0x92, 0x4a, 0xcc, 0xe6, 0xc9, 0xe0, 0xcc, 0x79, 0xe1, 0x6b, 0x47, 0x76, 0x72, 0x0c,
+    0x7d, 0xab, 0x11, 0x91, 0x45, 0xfb, 0x29, 0xf5, 0xf8, 0xcd, 0xbf, 0x31, 0x9a, 0x72, 0xf0, 0x64,
+    0x17, 0xdd, 0x8a, 0xa6, 0xd0, 0xcb, 0x34, 0x4d, 0xa3, 0xd9, 0xc4, 0xdb, 0xf5, 0x63, 0xe7, 0x98,
+    0xfe, 0x7a, 0x6b, 0x94, 0x42, 0xdb, 0x81, 0x7a, 0x35, 0x37, 0x36, 0xd8, 0xb5, 0xd2, 0x4d, 0x3e,
+    0xbe, 0x28, 0xd1, 0xd4, 0xec, 0xcb, 0xa1, 0xbf, 0x6b, 0xbf, 0xc4, 0x71, 0x02, 0xd7, 0x2f, 0xb7,
+    0x9c, 0xa4, 0x82, 0xcd, 0xe3, 0x64, 0x0a, 0xbf, 0x5d, 0x5c, 0x5c, 0x0c, 0xb6, 0x16, 0x19, 0xbb,
+    0x58, 0x89, 0x82, 0xea, 0x82, 0x3e, 0xcb, 0xe3, 0xe8, 0xdc, 0x89, 0x06, 0xa9, 0xa6, 0x8f, 0x93,
+    0x12, 0x7d, 0x6e, 0xe4, 0x15, 0x44, 0x37, 0x7f, 0xdf, 0xde, 0x45, 0xd3, 0x49, 0x8e, 0x42, 0xa2,
+    0x75, 0x57, 0xf0, 0x08, 0x51, 0x97, 0xc0, 0xd9, 0xdd, 0xba, 0xc2, 0x88, 0x54, 0x44, 0x55, 0xa9,
+    0x22, 0x13, 0x5c, 0xfe, 0xf3, 0x6f, 0x67, 0xab, 0xd5, 0xea, 0x8c, 0xeb, 0x74, 0x56, 0x5b, 0x85,
+    0x3a, 0x33, 0x12, 0x65, 0x04, 0x4f, 0xd3, 0xc9, 0xdc, 0xc8, 0xf5, 0x55, 0xa8, 0x74, 0xea, 0xcd,
+    0xad, 0xb7, 0x94, 0x38, 0x41, 0x9a, 0xb8, 0x62, 0xa9, 0x85, 0xba, 0xda, 0x86, 0xdb, 0x8a, 0x26,
+    0x4f, 0x8c, 0x54, 0x51, 0x2f, 0xfa, 0xbc, 0xba, 0x64, 0x49, 0x5c, 0x2c, 0x20, 0xfe, 0x85, 0xf0,
+    0xa7, 0xe6, 0x21, 0x21, 0xb0, 0x23, 0xc5, 0x45, 0xdb, 0x50, 0x05, 0xd1, 0x5a, 0x63, 0x09, 0x25,
+    0x3c, 0xe7, 0x8c, 0xd3, 0x56, 0x77, 0x36, 0xb1, 0xe8, 0x6b, 0xab, 0x67, 0x93, 0xa7, 0xf1, 0xd6,
+    0xa0, 0x4c, 0x81, 0x24, 0x1a, 0x89, 0x59, 0x7a, 0x09, 0xde, 0x04, 0x27, 0x9c, 0x5b, 0xea, 0x5c,
+    0x21, 0xd3, 0x46, 0xa8, 0x1a, 0x49, 0x12, 0xb5, 0x0d, 0xac, 0x08, 0x3d, 0x5b, 0xdd, 0x06, 0x7f,
+    0x71, 0xeb, 0x96, 0xc0, 0x3e, 0x51, 0x69, 0xa8, 0xb8, 0x84, 0x23, 0x69, 0x1b, 0x6c, 0x14, 0xa6,
+    0x2b, 0x61, 0x75, 0x1c, 0xbd, 0xe7, 0xb2, 0xc3, 0x42, 0x14, 0x0a, 0xe5, 0x94, 0xfe, 0x2b, 0xc5,
+    0x81, 0xe6, 0x22, 0x7b, 0xe0, 0x68, 0x9a, 0x4a, 0xda, 0x20, 0x0c, 0x4c, 0x67, 0x0f, 0x63, 0x4c,
+    0x3a, 0xed, 0x29, 0xd0, 0xbe, 0xf5, 0xd3, 0x62, 0x0d, 0x49, 0x58, 0x2c, 0x4d, 0x83, 0xa3, 0x73,
+    0x65, 0x97, 0x81, 0xd4, 0x2e, 0xcd, 0xc8, 0x1b, 0x62, 0xd2, 0x59, 0xb5, 0x0a, 0x4c, 0xc1, 0xa7,
+    0xd0, 0xa2, 0xdd, 0xf9, 0x83, 0xe3, 0x55, 0x80, 0x9e, 0xda, 0x92, 0x78, 0x44, 0xd0, 0x90, 0x30,
+    0xd3, 0x44, 0x61, 0xaa, 0xcd, 0x8a, 0xe8, 0xfa, 0x1c, 0x5e, 0x10, 0x33, 0x2f, 0x66, 0x93, 0x55,
+    0x4e, 0x09, 0x40, 0xbc, 0x75, 0xf4, 0xfb, 0x60, 0xc2, 0x4e, 0x5a, 0xb6, 0xf2, 0x48, 0xdc, 0x58,
+    0x53, 0x16, 0x0e, 0x63, 0xcb, 0x5c, 0xdf, 0x22, 0xbf, 0x9d, 0xc2, 0x25, 0xb3, 0x9c, 0x90, 0x29,
+    0xe4, 0x19, 0x0d, 0x93, 0x35, 0xc4, 0x1f, 0x23, 0xfd, 0x79, 0x37, 0xaa, 0xc4, 0x7d, 0x18, 0xb8,
+    0xff, 0xe7, 0xbb, 0x3b, 0xa2, 0xee, 0x3e, 0xdf, 0x98, 0xa9, 0x85, 0xae, 0x91, 0x5b, 0x31, 0xf8,
+    0xe2, 0xc3, 0x7f, 0x1d, 0xed, 0x1f, 0xae, 0x0b, 0x84, 0x8e, 0x43, 0x8c, 0x5d, 0xde, 0xad, 0x3a,
+    0x9c, 0x9f, 0x83, 0xcf, 0x11, 0x5e, 0xdd, 0x40, 0x29, 0xd6, 0x30, 0x47, 0x98, 0xd7, 0x6e, 0xcd,
+    0xbd, 0x01, 0x01, 0xa5, 0xe1, 0x5a, 0x43, 0x9b, 0x3f, 0x6b, 0xdd, 0xde, 0xbd, 0x02, 0x22, 0x19,
+    0x72, 0x38, 0x66, 0xa0, 0xa3, 0x72, 0x33, 0x0c, 0xe7, 0x03, 0x85, 0xa9, 0x80, 0xd7, 0xd4, 0xf6,
+    0x6c, 0xa0, 0x67, 0x34, 0x3e, 0x08, 0x87, 0x1c, 0x66, 0x27, 0xe4, 0xbc, 0xe3, 0x6e, 0x10, 0xfd,
+    0x25, 0x7c, 0x9e, 0x5a, 0x53, 0x6b, 0xc9, 0x21, 0x50, 0x89, 0xca, 0xa1, 0xbc, 0x2f, 0x1d, 0x9c,
+    0xb7, 0xf5, 0x64, 0x5d, 0x17, 0x71, 0x72, 0xa8, 0x1c, 0xc2, 0x28, 0x14, 0x9a, 0xf6, 0x1f, 0x22,
+    0x41, 0x79, 0x04, 0x08, 0x2d, 0xf2, 0x5e, 0x54, 0x54, 0xf0, 0x7c, 0x12, 0xa5, 0x70, 0x47, 0x75,
+    0x90, 0xd8, 0x14, 0x19, 0x72, 0x7d, 0x69, 0x65, 0x7b, 0x07, 0x85, 0xa6, 0x6a, 0x2d, 0x88, 0x00,
+    0x0e, 0x29, 0xa2, 0x74, 0x33, 0x3a, 0xea, 0x42, 0xc3, 0xda, 0xd4, 0x16, 0xaa, 0xdc, 0x10, 0xbd,
+    0xc8, 0xbf, 0xcf, 0x05, 0x53, 0xc5, 0xaf, 0x8c, 0x7d, 0x60, 0xce, 0x0f, 0x13, 0x3f, 0x96, 0x41,
+    0x3b, 0x3d, 0x27, 0xe1, 0xd7, 0x4a, 0x82, 0x36, 0xbe, 0x6f, 0xca, 0x91, 0x34, 0xae, 0x7a, 0x81,
+    0x45, 0x41, 0x7c, 0xb8, 0x67, 0x17, 0x9c, 0x0d, 0xc4, 0xad, 0x60, 0xf7, 0x98, 0x2d, 0x12, 0xda,
+    0x32, 0x39, 0xf2, 0xa0, 0x52, 0xba, 0x95, 0x70, 0x8e, 0x00, 0x4b, 0x10, 0x9a, 0x8a, 0x44, 0xc4,
+    0x15, 0x4b, 0x51, 0xe8, 0x1d, 0xf8, 0xa3, 0x2b, 0xeb, 0x93, 0x21, 0x2b, 0xb7, 0xa2, 0x9d, 0xb7,
+    0xa0, 0xe1, 0x08, 0xee, 0xda, 0xea, 0xcd, 0x80, 0x18, 0xca, 0x9c, 0x13, 0x8a, 0xc2, 0xca, 0x35,
+    0xe4, 0xc4, 0xf8, 0xbe, 0xa4, 0xb4, 0xe5, 0xb8, 0xad, 0x07, 0x73, 0x6c, 0x71, 0x51, 0x28, 0x15,
+    0x73, 0x35, 0x7e, 0x34, 0x40, 0x74, 0xb2, 0x28, 0x96, 0x81, 0xff, 0x3f, 0x33, 0x40, 0x7d, 0x26,
+    0xdd, 0x65, 0xb7, 0x58, 0x1e, 0x9d, 0x22, 0x36, 0xa1, 0xb3, 0x50, 0xd8, 0xe4, 0xc4, 0x15, 0x4b,
+    0xc7, 0x54, 0xc2, 0x76, 0x17, 0x5f, 0x43, 0x6f, 0xb1, 0xb1, 0xa7, 0x12, 0x68, 0x51, 0xe2, 0x09,
+    0x17, 0x9d, 0xc6, 0x9e, 0x97, 0x4e, 0xba, 0x71, 0x64, 0xbc, 0xb8, 0xef, 0xdb, 0x73, 0xc2, 0xdb,
+    0xb6, 0xda, 0x9e, 0xcb, 0xed, 0xa3, 0x8d, 0x5f, 0x4a, 0x1a, 0xfd, 0x7d, 0x6e, 0x94, 0xbc, 0xef,
+    0x38, 0x7d, 0xc2, 0xfb, 0xa1, 0xf2, 0x5e, 0x8c, 0x43, 0x85, 0xb0, 0xb7, 0x29, 0x54, 0xa8, 0xf6,
+    0x03, 0x98, 0x05, 0x7c, 0x09, 0x0f, 0x93, 0x22, 0xbb, 0x2f, 0x2a, 0xea, 0x57, 0xff, 0x65, 0x49,
+    0x83, 0xb0, 0x12, 0xeb, 0x2d, 0x09, 0xad, 0x7a, 0x9a, 0x9f, 0x2d, 0x81, 0xd4, 0x2e, 0xfa, 0x9a,
+    0xf4, 0xc8, 0xbf, 0x3c, 0x7c, 0x1d, 0x47, 0xfa, 0xb0, 0x03, 0x8b, 0x54, 0xf7, 0xf7, 0x22, 0xf3,
+    0x78, 0x20, 0xd9, 0xc1, 0x35, 0xa2, 0x8c, 0x90, 0x9f, 0xda, 0xd9, 0x75, 0xb1, 0xf0, 0x1e, 0xcb,
+    0xca, 0xff, 0x0c, 0x15, 0x5d, 0x26, 0xfe, 0x07, 0x07, 0xd9, 0xea, 0x28, 0x09, 0xdb, 0x63, 0x55,
+    0x84, 0x4d, 0x3f, 0xda, 0x94, 0x6e, 0xc9, 0x84, 0x87, 0x1e, 0xeb, 0xee, 0x0f, 0x66, 0xb4, 0xd3,
+    0x02, 0xcd, 0x2d, 0xe0, 0x88, 0x69, 0x6f, 0xb7, 0xb9, 0x1e, 0x4d, 0xb5, 0x13, 0x28, 0xa3, 0x71,
+    0xf5, 0xd8, 0xc5, 0x22, 0x6a, 0x55, 0x5c, 0x1b, 0x8e, 0x42, 0x9f, 0x86, 0xf2, 0xea, 0x8e, 0xf0,
+    0x2c, 0x53, 0x62, 0x8e, 0x2a, 0xc8, 0x2c, 0x09, 0xc3, 0x5a, 0x95, 0xaf, 0x4b, 0x5e, 0x39, 0x31,
+    0xa9, 0x61, 0x56, 0x5b, 0x84, 0x3f, 0x08, 0x10, 0x50, 0x61, 0xa6, 0x14, 0x0d, 0xf5, 0x80, 0x99,
+    0x5e, 0x71, 0xa8, 0xe5, 0x1b, 0xba, 0x80, 0x64, 0x4c, 0xae, 0xc2, 0xfd, 0x1e, 0x76, 0x24, 0x23,
+    0xe5, 0x3f, 0x9a, 0x2f, 0x90, 0x67, 0xcf, 0x76, 0xa1, 0xa7, 0xf4, 0xc6, 0x5b, 0xfa, 0x3c, 0x2c,
+    0xd0, 0x0b, 0x3e, 0xed, 0x7a, 0x45, 0xf7, 0xf6, 0xe5, 0x45, 0x32, 0x39, 0x78, 0x95, 0x1e, 0xeb,
+    0x2b, 0xa1, 0xbb, 0xa4, 0xc7, 0xe9, 0xaf, 0xed, 0xe3, 0xf4, 0x90, 0x25, 0x3b, 0x36, 0x3b, 0xef,
+    0x57, 0xf4, 0x1f, 0x74, 0x55, 0x9f, 0xec, 0xcd, 0xb1, 0x81, 0xd9, 0xf1, 0xf0, 0xb6, 0x70, 0x95,
+    0xa2, 0xdd, 0xf8, 0x23, 0x1f, 0x9d, 0x5e, 0xd4, 0x31, 0x69, 0x13, 0x9d, 0x61, 0x0e, 0xbc, 0xad,
+    0x2b, 0x7a, 0xe1, 0xe2, 0xe7, 0x2d, 0x83, 0xb0, 0x41, 0xf9, 0x29, 0xd2, 0x50, 0x88, 0x4a, 0x58,
+    0x87, 0x1f, 0xa8, 0x97, 0x1b, 0xf3, 0xb6, 0x8f, 0x09, 0x7c, 0xff, 0x4e, 0x15, 0x6b, 0x7d, 0x37,
+    0x5c, 0xbd, 0x24, 0x18, 0x5c, 0xf6, 0x92, 0x97, 0xfc, 0x44, 0x6a, 0x65, 0x2f, 0xf8, 0xa5, 0xb4,
+    0xef, 0x80, 0xe4, 0xcd, 0x16, 0xb2, 0x2e, 0x78, 0xb2, 0x93, 0xe3, 0x1e, 0x2f, 0x1b, 0x6e, 0xf1,
+    0x96, 0x9f, 0xc3, 0x1f, 0x59, 0x59, 0x2e, 0xf4, 0x92, 0x7f, 0x10, 0x1c, 0xa6, 0x95, 0xcc, 0x4e,
+    0x9b, 0x16, 0x2c, 0x1f, 0xb3, 0x3c, 0x56, 0x25, 0x06, 0xf3, 0x1f, 0x8d, 0xb0, 0xa5, 0x15, 0x07,
+    0x0e, 0x00, 0x00,
+};
+
+// style.css: 204 bytes minified, 156 gzipped
+static const uint8_t WEB_ASSET_2[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x5d, 0x8d, 0x3b, 0x0e, 0xc2, 0x30,
+    0x10, 0x05, 0x7b, 0x4e, 0x41, 0x43, 0x17, 0xa3, 0x04, 0x09, 0x0a, 0xa7, 0xa2, 0xe3, 0x1a, 0xeb,
+    0x78, 0x1d, 0x56, 0xac, 0x3f, 0x8a, 0x37, 0x41, 0x91, 0x95, 0xbb, 0x13, 0x04, 0x45, 0xa0, 0x7d,
+    0x33, 0x4f, 0x63, 0xa2, 0x9d, 0x8b, 0x8b, 0x41, 0x94, 0x03, 0x4f, 0x3c, 0xeb, 0xeb, 0x40, 0xc0,
+    0xd5, 0x0d, 0x79, 0x42, 0xa1, 0x0e, 0xaa, 0x0c, 0x21, 0xab, 0x8c, 0x03, 0xb9, 0xd6, 0xc3, 0xd0,
+    0x53, 0xd0, 0x0d, 0xfa, 0x85, 0xc1, 0x20, 0x17, 0x4b, 0x39, 0x31, 0xcc, 0xda, 0x70, 0xec, 0x1e,
+    0x5f, 0xac, 0x24, 0x26, 0x5d, 0x1f, 0xcf, 0xab, 0x44, 0x21, 0x8d, 0x52, 0x9e, 0x64, 0xe5, 0xae,
+    0x9b, 0xba, 0x3e, 0xb4, 0x09, 0xac, 0xa5, 0xd0, 0x7f, 0xf0, 0xaf, 0x7f, 0x5a, 0x7d, 0x33, 0x8a,
+    0xc4, 0x50, 0x36, 0xfb, 0x9a, 0xda, 0x9c, 0x2e, 0xe8, 0xf7, 0xef, 0xb8, 0x45, 0x01, 0xe2, 0xfc,
+    0x27, 0x2e, 0xbb, 0x17, 0x53, 0xf7, 0xcc, 0x9f, 0xcc, 0x00, 0x00, 0x00,
+};
+
+static const WebAsset WEB_ASSETS[] = {
+    {"/", "text/html", "\"eed35ffddcb6475b\"", false, WEB_ASSET_0, sizeof(WEB_ASSET_0)},
+    {"/app.js", "application/javascript", "\"5abca13c0b09d997\"", true, WEB_ASSET_1, sizeof(WEB_ASSET_1)},
+    {"/style.css", "text/css", "\"3a2514fb0a0ac86e\"", true, WEB_ASSET_2, sizeof(WEB_ASSET_2)},
+};
+
+static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);
@@ -0,0 +1,78 @@
+#include "web_ui.h"
+#include "web_assets.h"
+#include "logger.h"
+#include "metrics.h"
+#include <LittleFS.h>
+
+// Set at registration for assets with a LittleFS override under /ui/.
+static bool hasOverride[WEB_ASSET_COUNT];
+
+static void overridePath(const WebAsset &a, char *out, size_t outSize)
+{
+    snprintf(out, outSize, "/ui%s", strcmp(a.path, "/") == 0 ? "/index.html" : a.path);
+}
+
+static void sendAsset(WebServer &srv, size_t idx)
+{
+    const WebAsset &a = WEB_ASSETS[idx];
+    if (hasOverride[idx])
+    {
+        char path[48];
+        overridePath(a, path, sizeof(path));
+        File f = LittleFS.open(path, "r");
+        metricsCountFs(MET_FS_OPEN);
+        if (f)
+        {
+            srv.sendHeader("Cache-Control", "no-cache");
+            srv.streamFile(f, a.contentType);
+            f.close();
+            return;
+        }
+    }
+
+    srv.sendHeader("ETag", a.etag);
+    // Fingerprinted assets never change under the same URL; index.html is
+    // always revalidated (a cheap 304) so a firmware update shows up at once.
+    srv.sendHeader("Cache-Control", a.immutable ? "public, max-age=31536000, immutable" : "no-cache");
+    srv.sendHeader("Vary", "Accept-Encoding");
+    if (srv.header("If-None-Match") == a.etag)
+    {
+        srv.send(304);
+        return;
+    }
+    if (srv.header("Accept-Encoding").indexOf("gzip") < 0)
+    {
+        // Every browser accepts gzip; this is for bare HTTP clients. Serve the
+        // uncompressed uploadfs copy when there is one.
+        const char *plain = strcmp(a.path, "/") == 0 ? "/index.html" : a.path;
+        if (LittleFS.exists(plain))
+        {
+            File f = LittleFS.open(plain, "r");
+            metricsCountFs(MET_FS_OPEN);
+            srv.streamFile(f, a.contentType);
+            f.close();
+            return;
+        }
+        LOG_D("%s: client does not accept gzip; sending it anyway", a.path);
+    }
+    srv.sendHeader("Content-Encoding", "gzip");
+    srv.send_P(200, a.contentType, (PGM_P)a.gz, a.gzLen);
+}
+
+void registerWebUi(WebServer &srv)
+{
+    for (size_t i = 0; i < WEB_ASSET_COUNT; ++i)
+    {
+        char path[48];
+        overridePath(WEB_ASSETS[i], path, sizeof(path));
+        hasOverride[i] = LittleFS.exists(path);
+        if (hasOverride[i])
+            LOG_I("Web UI: %s overridden by LittleFS %s", WEB_ASSETS[i].path, path);
+
+        srv.on(WEB_ASSETS[i].path, HTTP_GET, [&srv, i]()
+               { sendAsset(srv, i); });
+        if (strcmp(WEB_ASSETS[i].path, "/") == 0)
+            srv.on("/index.html", HTTP_GET, [&srv, i]()
+                   { sendAsset(srv, i); });
+    }
+}
@@ -0,0 +1,13 @@
+// web_ui.h
+// Captive-portal UI served from flash (src/web_assets.h, generated from
+// data/ by scripts/embed_assets.py): gzip-encoded, strong ETag, 304 on
+// revalidation. A file under /ui/ on LittleFS (e.g. /ui/app.js) overrides the
+// embedded copy, for UI updates without reflashing.
+#pragma once
+
+#include <WebServer.h>
+
+// Register GET routes for every embedded asset (plus /index.html). Needs the
+// "If-None-Match" and "Accept-Encoding" headers collected on srv and LittleFS
+// mounted; overrides are looked up once, here.
+void registerWebUi(WebServer &srv);
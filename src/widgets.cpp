@@ -0,0 +1,114 @@
+#include "widgets.h"
+#include "fonts.h"
+#include <string.h>
+
+// Size 1 is the built-in GFX font (5x7 glyphs in 6x8 cells); 2 and 3 are the
+// 16 and 24 pixel bitmap fonts, which replace the blocky scaled GFX glyphs.
+static const int CHAR_W = 6;
+
+static const Font *fontFor(int size)
+{
+    return size >= 3 ? &FONT_SANS_24 : size == 2 ? &FONT_SANS_16 : nullptr;
+}
+
+static int textWidth(int size, const char *text)
+{
+    const Font *font = fontFor(size);
+    return font ? fontTextWidth(*font, text) : (int)strlen(text) * CHAR_W;
+}
+
+void WidgetScreen::show(const Widget *table, uint8_t n)
+{
+    widgets = table;
+    count = n < WIDGET_MAX ? n : WIDGET_MAX;
+    full = table != nullptr;
+}
+
+// Refresh the slot from the widget's source; true when what it renders
+// changed (or on the first sample after show()).
+bool WidgetScreen::sample(const Widget &w, Slot &s, bool first)
+{
+    if (w.kind == WidgetKind::Label)
+        return first;
+    uint32_t stamp = w.stamp ? w.stamp(w.arg) : 0;
+    if (!first && (!w.stamp || stamp == s.stamp))
+        return false;
+    s.stamp = stamp;
+    if (w.kind == WidgetKind::Value)
+    {
+        char buf[WIDGET_TEXT_MAX];
+        buf[0] = '\0';
+        if (w.text)
+            w.text(w.arg, buf, sizeof(buf));
+        if (!first && strcmp(buf, s.text) == 0)
+            return false; // e.g. a new climate reading that rounds the same
+        memcpy(s.text, buf, sizeof(buf));
+        return true;
+    }
+    uint8_t level = w.level ? w.level(w.arg) : 0;
+    if (!first && level == s.level)
+        return false;
+    s.level = level;
+    return true;
+}
+
+void WidgetScreen::draw(Adafruit_SSD1306 &gfx, const Widget &w, const Slot &s)
+{
+    switch (w.kind)
+    {
+    case WidgetKind::Label:
+    case WidgetKind::Value:
+    {
+        const char *text = w.kind == WidgetKind::Label ? w.label : s.text;
+        int size = w.size;
+        if (size == 0)
+        {
+            for (size = 3; size > 1 && textWidth(size, text) > w.w; size--)
+                ;
+        }
+        int width = textWidth(size, text);
+        int x = w.x;
+        if (w.align == WidgetAlign::Center && width < w.w)
+            x += (w.w - width) / 2;
+        const Font *font = fontFor(size);
+        if (font)
+        {
+            fontDrawText(gfx, *font, x, w.y, text);
+            break;
+        }
+        gfx.setTextSize(1);
+        gfx.setCursor(x, w.y);
+        gfx.print(text);
+        break;
+    }
+    case WidgetKind::Bar:
+        gfx.drawRect(w.x, w.y, w.w, w.h, SSD1306_WHITE);
+        if (s.level)
+            gfx.fillRect(w.x + 2, w.y + 2, (int16_t)((w.w - 4) * s.level / 255), w.h - 4, SSD1306_WHITE);
+        break;
+    case WidgetKind::Icon:
+        if (s.level && w.bitmap)
+            gfx.drawBitmap(w.x, w.y, w.bitmap, w.w, w.h, SSD1306_WHITE);
+        break;
+    }
+}
+
+uint8_t WidgetScreen::update(Adafruit_SSD1306 &gfx)
+{
+    bool first = full;
+    full = false;
+    if (first)
+        gfx.clearDisplay();
+    uint8_t drawn = 0;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const Widget &w = widgets[i];
+        if (!sample(w, slots[i], first))
+            continue;
+        if (!first)
+            gfx.fillRect(w.x, w.y, w.w, w.h, SSD1306_BLACK);
+        draw(gfx, w, slots[i]);
+        drawn++;
+    }
+    return drawn;
+}
@@ -0,0 +1,108 @@
+// widgets.h
+// Retained-mode widgets for the OLED. A screen is a fixed table of widgets,
+// each optionally bound to a data source through a change stamp. update()
+// polls the stamps (cheap: a counter or the raw value itself), formats a
+// widget only when its stamp moved, and clears and redraws only the widgets
+// whose rendered text or level actually differs from what is in the
+// framebuffer. A pass where nothing visible changed draws nothing, so there
+// is nothing to flush.
+//
+//   Label  fixed text
+//   Value  text from a format callback
+//   Bar    frame plus a fill of level/255
+//   Icon   bitmap, shown while level is nonzero
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <Adafruit_SSD1306.h>
+
+// Most widgets on one screen, and the longest text a widget renders
+// (a 32-character SSID plus its caption).
+static const uint8_t WIDGET_MAX = 8;
+static const size_t WIDGET_TEXT_MAX = 48;
+
+enum class WidgetKind : uint8_t
+{
+    Label,
+    Value,
+    Bar,
+    Icon,
+};
+
+enum class WidgetAlign : uint8_t
+{
+    Left,
+    Center,
+};
+
+// Callbacks get the widget's arg, so one function can serve e.g. every menu
+// line. A stamp must change whenever the rendered output may have.
+typedef uint32_t (*WidgetStampFn)(uint8_t arg);
+typedef void (*WidgetTextFn)(uint8_t arg, char *buf, size_t cap);
+typedef uint8_t (*WidgetLevelFn)(uint8_t arg);
+
+struct Widget
+{
+    WidgetKind kind;
+    int16_t x, y, w, h;    // area cleared before the widget is redrawn
+    uint8_t size;          // text rows of 8 px: 1 GFX font, 2/3 fonts.h; 0 = largest that fits w
+    WidgetAlign align;
+    uint8_t arg;
+    const char *label;     // Label
+    const uint8_t *bitmap; // Icon: w x h, drawBitmap() layout
+    WidgetStampFn stamp;   // nullptr: sampled once per show()
+    WidgetTextFn text;     // Value
+    WidgetLevelFn level;   // Bar, Icon
+};
+
+constexpr Widget widgetLabel(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t size, const char *text,
+                             WidgetAlign align = WidgetAlign::Left)
+{
+    return Widget{WidgetKind::Label, x, y, w, h, size, align, 0, text, nullptr, nullptr, nullptr, nullptr};
+}
+
+constexpr Widget widgetValue(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t size, WidgetStampFn stamp,
+                             WidgetTextFn text, uint8_t arg = 0, WidgetAlign align = WidgetAlign::Left)
+{
+    return Widget{WidgetKind::Value, x, y, w, h, size, align, arg, nullptr, nullptr, stamp, text, nullptr};
+}
+
+constexpr Widget widgetBar(int16_t x, int16_t y, int16_t w, int16_t h, WidgetStampFn stamp, WidgetLevelFn level,
+                           uint8_t arg = 0)
+{
+    return Widget{WidgetKind::Bar, x, y, w, h, 0, WidgetAlign::Left, arg, nullptr, nullptr, stamp, nullptr, level};
+}
+
+constexpr Widget widgetIcon(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t *bitmap,
+                            WidgetStampFn stamp, WidgetLevelFn level, uint8_t arg = 0)
+{
+    return Widget{WidgetKind::Icon, x, y, w, h, 0, WidgetAlign::Left, arg, nullptr, bitmap, stamp, nullptr, level};
+}
+
+class WidgetScreen
+{
+public:
+    // Bind a screen; the next update() clears the panel and draws all of
+    // it. Widgets past WIDGET_MAX are ignored. nullptr/0 unbinds.
+    void show(const Widget *table, uint8_t count);
+    // Sample the bound data and redraw what changed into gfx. Returns the
+    // number of widgets drawn; 0 means the framebuffer is unchanged.
+    uint8_t update(Adafruit_SSD1306 &gfx);
+
+private:
+    struct Slot
+    {
+        uint32_t stamp;
+        uint8_t level;
+        char text[WIDGET_TEXT_MAX];
+    };
+
+    bool sample(const Widget &w, Slot &s, bool first);
+    void draw(Adafruit_SSD1306 &gfx, const Widget &w, const Slot &s);
+
+    const Widget *widgets = nullptr;
+    uint8_t count = 0;
+    bool full = false;
+    Slot slots[WIDGET_MAX];
+};
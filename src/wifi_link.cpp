@@ -0,0 +1,248 @@
+#include "wifi_link.h"
+#include "globals.h"
+#include "init.h"
+#include "logger.h"
+#include "provisioning.h"
+#include "scheduler.h"
+#include "status_server.h"
+#include "system.h"
+#include "fast_connect.h"
+#include <Arduino.h>
+#include <WiFi.h>
+#include <atomic>
+
+// While the fallback AP is open the station side keeps trying, slowly and
+// only while no phone is connected to the portal.
+static const uint32_t AP_RETRY_MS = 60000;
+// Lets a portal client see the /save/status result before the restart.
+static const uint32_t AP_RESTART_DELAY_MS = 5000;
+
+enum class LinkState : uint8_t
+{
+    Inactive, // wifiLinkBegin() not called (provisioning-only boot)
+    Up,
+    Backoff,    // waiting for retryAt
+    Connecting, // WiFi.begin() issued at attemptAt
+    ApOpen,     // provisioning AP running; see AP_RETRY_MS
+};
+
+// Set by the Wi-Fi event task, consumed by wifiLinkLoop().
+static std::atomic<bool> gotIpEvent{false};
+static std::atomic<bool> disconnectEvent{false};
+static std::atomic<uint8_t> disconnectReason{0};
+
+// Net-task state: only wifiLinkLoop() and what it calls touch these.
+static LinkState state = LinkState::Inactive;
+static unsigned long outageStart = 0;
+static unsigned long retryAt = 0;
+static unsigned long attemptAt = 0;
+static uint8_t attempt = 0;
+// False until the station has had a link since boot; the first one is the
+// initial connection, not a reconnect.
+static bool everUp = false;
+
+// Published copy for wifiLinkStats(), with the outage in progress (if any):
+// other tasks read only these, under statsMux, never the state above.
+static WifiLinkStats stats = {};
+static bool statsInOutage = false;
+static unsigned long statsOutageStart = 0;
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+static void onGotIp(WiFiEvent_t, WiFiEventInfo_t)
+{
+    gotIpEvent.store(true, std::memory_order_release);
+    schedWake(wifiLinkLoop);
+}
+
+static void onDisconnected(WiFiEvent_t, WiFiEventInfo_t info)
+{
+    disconnectReason.store(info.wifi_sta_disconnected.reason, std::memory_order_relaxed);
+    disconnectEvent.store(true, std::memory_order_release);
+    schedWake(wifiLinkLoop);
+}
+
+static void scheduleRetry(unsigned long now)
+{
+    uint32_t delayMs = WIFI_BACKOFF_MAX_MS;
+    if (attempt < 16 && (WIFI_BACKOFF_MIN_MS << attempt) < WIFI_BACKOFF_MAX_MS)
+        delayMs = WIFI_BACKOFF_MIN_MS << attempt;
+    // +-25% jitter
+    delayMs = delayMs - delayMs / 4 + esp_random() % (delayMs / 2 + 1);
+    if (attempt < 255)
+        ++attempt;
+    retryAt = now + delayMs;
+    state = LinkState::Backoff;
+    LOG_I("WiFi: retry %u in %lu ms", (unsigned)attempt, (unsigned long)delayMs);
+}
+
+static void beginAttempt(unsigned long now)
+{
+    disconnectEvent.store(false, std::memory_order_relaxed);
+    WiFi.disconnect();
+    // Plain scan and DHCP (or the configured static IP): the boot-time
+    // directed connect and cached lease are what may have gone stale.
+    applyIpConfig(cfg, nullptr);
+    WiFi.begin(cfg.ssid, cfg.psk);
+    attemptAt = now;
+}
+
+static void linkLost(unsigned long now)
+{
+    uint8_t reason = disconnectReason.load(std::memory_order_relaxed);
+    LOG_W("WiFi: link lost (reason %u)", (unsigned)reason);
+    outageStart = now;
+    attempt = 0;
+    portENTER_CRITICAL(&statsMux);
+    stats.up = false;
+    stats.lastReason = reason;
+    statsInOutage = true;
+    statsOutageStart = now;
+    portEXIT_CRITICAL(&statsMux);
+    scheduleRetry(now);
+}
+
+static void linkRestored(unsigned long now)
+{
+    uint32_t outage = now - outageStart;
+    bool initial = !everUp;
+    everUp = true;
+    state = LinkState::Up;
+    portENTER_CRITICAL(&statsMux);
+    stats.up = true;
+    statsInOutage = false;
+    if (!initial)
+    {
+        stats.reconnects++;
+        stats.lastOutageMs = outage;
+        stats.totalOutageMs += outage;
+        if (outage > stats.longestOutageMs)
+            stats.longestOutageMs = outage;
+    }
+    portEXIT_CRITICAL(&statsMux);
+    if (cfg.wifi_fast_connect > 0)
+        saveFastConnect(cfg); // the AP or channel may have changed
+    if (initial)
+    {
+        // The boot-time connect timed out, but the services were started
+        // anyway and pick up the new interface by themselves.
+        LOG_I("WiFi: connected %lu ms after boot, IP %s", (unsigned long)now, WiFi.localIP().toString().c_str());
+        return;
+    }
+    LOG_I("WiFi: reconnected after %lu ms, IP %s", (unsigned long)outage, WiFi.localIP().toString().c_str());
+    restartNetworkServices();
+}
+
+static void openAp(const char *why)
+{
+    LOG_W("WiFi: opening provisioning AP (%s)", why);
+    stopStatusServer(); // the portal takes over port 80
+    startProvisioning();
+    state = LinkState::ApOpen;
+    attemptAt = millis();
+}
+
+void wifiLinkBegin(bool connected)
+{
+    WiFi.setAutoReconnect(false);
+    WiFi.onEvent(onGotIp, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    WiFi.onEvent(onDisconnected, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+    gotIpEvent.store(false, std::memory_order_relaxed);
+    disconnectEvent.store(false, std::memory_order_relaxed);
+    unsigned long now = millis();
+    everUp = connected;
+    portENTER_CRITICAL(&statsMux);
+    stats.up = connected;
+    statsInOutage = !connected;
+    statsOutageStart = 0;
+    portEXIT_CRITICAL(&statsMux);
+    if (connected)
+    {
+        state = LinkState::Up;
+        return;
+    }
+    // The boot-time connect already timed out: count the outage from boot.
+    outageStart = 0;
+    attempt = 0;
+    scheduleRetry(now);
+}
+
+void wifiLinkLoop()
+{
+    if (state == LinkState::Inactive)
+        return;
+    unsigned long now = millis();
+    bool gotIp = gotIpEvent.exchange(false, std::memory_order_acquire);
+    bool dropped = disconnectEvent.exchange(false, std::memory_order_acquire);
+
+    if (state == LinkState::ApOpen)
+    {
+        if (gotIp)
+        {
+            // Come back up as a plain station; the AP cannot be torn down
+            // cleanly under a running portal.
+            LOG_I("WiFi: station link is back; restarting out of provisioning");
+            scheduleRestart(AP_RESTART_DELAY_MS);
+            state = LinkState::Inactive;
+            portENTER_CRITICAL(&statsMux);
+            statsInOutage = false;
+            portEXIT_CRITICAL(&statsMux);
+        }
+        else if (now - attemptAt >= AP_RETRY_MS && WiFi.softAPgetStationNum() == 0)
+        {
+            WiFi.begin(cfg.ssid, cfg.psk); // AP+STA: the AP stays up
+            attemptAt = now;
+        }
+        return;
+    }
+
+    if (takeApRequest())
+    {
+        openAp("button");
+        return;
+    }
+
+    if (state == LinkState::Up)
+    {
+        if (dropped || WiFi.status() != WL_CONNECTED)
+            linkLost(now);
+        return;
+    }
+
+    if (gotIp && WiFi.status() == WL_CONNECTED)
+    {
+        linkRestored(now);
+        return;
+    }
+    if (cfg.ap_fallback_minutes && now - outageStart >= (unsigned long)cfg.ap_fallback_minutes * 60000UL)
+    {
+        openAp("outage window");
+        return;
+    }
+    if (state == LinkState::Backoff && (long)(now - retryAt) >= 0)
+    {
+        beginAttempt(now);
+        state = LinkState::Connecting;
+    }
+    else if (state == LinkState::Connecting && (dropped || now - attemptAt >= WIFI_ATTEMPT_MS))
+    {
+        if (dropped)
+        {
+            portENTER_CRITICAL(&statsMux);
+            stats.lastReason = disconnectReason.load(std::memory_order_relaxed);
+            portEXIT_CRITICAL(&statsMux);
+        }
+        scheduleRetry(now);
+    }
+}
+
+WifiLinkStats wifiLinkStats()
+{
+    WifiLinkStats s;
+    portENTER_CRITICAL(&statsMux);
+    s = stats;
+    bool inOutage = statsInOutage;
+    unsigned long since = statsOutageStart;
+    portEXIT_CRITICAL(&statsMux);
+    s.outageMs = inOutage ? millis() - since : 0;
+    return s;
+}
@@ -0,0 +1,35 @@
+// wifi_link.h
+// Station link supervisor. WiFi.onEvent handlers only record link up/down;
+// wifiLinkLoop() (on the net scheduler task, core 0; see cores.h) reacts:
+// after a drop it reconnects with jittered exponential backoff, restarts the
+// network services once the link is back, and opens the provisioning AP
+// only after the configured outage window (ap_fallback_minutes) or on the
+// BOOT button gesture.
+#pragma once
+
+#include <stdint.h>
+
+// First retry delay and the cap the backoff doubles towards; each delay is
+// jittered by +-25% so a fleet does not reconnect in lockstep.
+static const uint32_t WIFI_BACKOFF_MIN_MS = 1000;
+static const uint32_t WIFI_BACKOFF_MAX_MS = 60000;
+// A WiFi.begin() attempt that has not produced an IP by then counts as failed.
+static const uint32_t WIFI_ATTEMPT_MS = 10000;
+
+struct WifiLinkStats
+{
+    bool up;
+    uint32_t reconnects;      // outages that ended in a reconnect
+    uint32_t outageMs;        // current outage, 0 while up
+    uint32_t lastOutageMs;    // duration of the most recent finished outage
+    uint32_t longestOutageMs;
+    uint32_t totalOutageMs;   // finished outages only
+    uint8_t lastReason;       // wifi_err_reason_t of the last disconnect
+};
+
+// Hook the Wi-Fi events and take over reconnects (Arduino's auto-reconnect is
+// disabled). connected is the outcome of the boot-time connect.
+void wifiLinkBegin(bool connected);
+void wifiLinkLoop();
+// Consistent copy of the counters; callable from any task.
+WifiLinkStats wifiLinkStats();
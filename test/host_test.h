@@ -0,0 +1,35 @@
+// host_test.h
+// Minimal checks for the host tests. No framework: the modules under test
+// are plain C++11 without Arduino calls, so each test is a small program
+// that prints what failed and exits nonzero (ctest reports it).
+#pragma once
+
+#include <stdio.h>
+#include <string>
+
+static int hostTestFailures = 0;
+
+#define EXPECT(cond)                                                  \
+    do                                                                \
+    {                                                                 \
+        if (!(cond))                                                  \
+        {                                                             \
+            printf("%s:%d: FAIL %s\n", __FILE__, __LINE__, #cond);    \
+            hostTestFailures++;                                       \
+        }                                                             \
+    } while (0)
+
+// Compare a recorded event trace against the expected one, by name.
+static inline void expectTrace(const char *name, const std::string &got, const std::string &want)
+{
+    bool ok = got == want;
+    if (!ok)
+        hostTestFailures++;
+    printf("%s %-32s %s%s%s\n", ok ? "ok  " : "FAIL", name, got.c_str(), ok ? "" : "  want: ", ok ? "" : want.c_str());
+}
+
+static inline int hostTestResult()
+{
+    printf("%d failure(s)\n", hostTestFailures);
+    return hostTestFailures != 0;
+}
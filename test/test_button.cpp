@@ -0,0 +1,101 @@
+// Replays timestamped BOOT button level traces through ButtonGestures, sampled
+// like buttonTask() does, and compares the gestures it reports.
+#include "button.h"
+#include "host_test.h"
+#include <initializer_list>
+#include <vector>
+
+struct Edge
+{
+    uint32_t ms;
+    bool down;
+};
+
+static const char *const GESTURE_NAMES[] = {"Press", "DoublePress", "HoldStart", "LongHold", "HoldEnd"};
+
+// Sample the traced level every stepMs from startMs to startMs + spanMs, like
+// the poll task: an edge between two samples is only seen at the next one.
+// Edge times are relative to startMs. Events print as name@at/held with at
+// relative to startMs.
+static std::string replay(const std::vector<Edge> &edges, uint32_t spanMs, uint32_t stepMs = 1,
+                          uint32_t longHoldMs = 5000, uint32_t startMs = 0)
+{
+    ButtonGestures g(longHoldMs);
+    std::string out;
+    size_t next = 0;
+    bool level = false;
+    for (uint32_t t = 0; t <= spanMs; t += stepMs)
+    {
+        while (next < edges.size() && edges[next].ms <= t)
+            level = edges[next++].down;
+        g.update(level, startMs + t);
+        ButtonEvent ev;
+        while (g.poll(ev))
+        {
+            char buf[48];
+            snprintf(buf, sizeof(buf), "%s@%u/%u ", GESTURE_NAMES[(int)ev.gesture], (unsigned)(ev.atMs - startMs),
+                     (unsigned)ev.heldMs);
+            out += buf;
+        }
+    }
+    return out;
+}
+
+// 4 ms of contact chatter ending on the new level.
+static std::vector<Edge> bouncy(uint32_t at, bool down)
+{
+    return {{at, down}, {at + 1, !down}, {at + 2, down}, {at + 3, !down}, {at + 4, down}};
+}
+
+static std::vector<Edge> join(std::initializer_list<std::vector<Edge>> parts)
+{
+    std::vector<Edge> all;
+    for (const std::vector<Edge> &p : parts)
+        all.insert(all.end(), p.begin(), p.end());
+    return all;
+}
+
+int main()
+{
+    // Debounced edges are dated to the last raw edge of the chatter.
+    expectTrace("bouncy press", replay(join({bouncy(100, true), bouncy(250, false)}), 1000), "Press@554/0 ");
+    expectTrace("bounce shorter than debounce", replay({{100, true}, {110, false}, {400, true}, {420, false}}, 1000), "");
+    expectTrace("double press",
+                replay(join({bouncy(100, true), bouncy(200, false), bouncy(400, true), bouncy(500, false)}), 1500),
+                "DoublePress@504/0 ");
+    expectTrace("two presses past the gap",
+                replay(join({bouncy(100, true), bouncy(200, false), bouncy(600, true), bouncy(700, false)}), 1500),
+                "Press@504/0 Press@1004/0 ");
+    expectTrace("second press settles late", replay({{100, true}, {200, false}, {480, true}, {600, false}}, 1500, 10),
+                "DoublePress@600/0 ");
+    expectTrace("click then hold", replay({{100, true}, {200, false}, {350, true}, {2000, false}}, 3000, 10),
+                "Press@1350/0 HoldStart@1350/1000 HoldEnd@2000/1650 ");
+    expectTrace("hold and release", replay(join({bouncy(100, true), bouncy(2100, false)}), 3000),
+                "HoldStart@1104/1000 HoldEnd@2104/2000 ");
+    expectTrace("long hold and release", replay(join({bouncy(100, true), bouncy(6000, false)}), 7000, 10),
+                "HoldStart@1100/1000 LongHold@5100/5000 HoldEnd@6000/5900 ");
+    expectTrace("coarse sampling", replay({{100, true}, {3600, false}}, 4000, 50),
+                "HoldStart@1100/1000 HoldEnd@3600/3500 ");
+    // millis() wraps 256 ms into the trace: durations must not notice.
+    expectTrace("millis wraparound, hold", replay({{100, true}, {2500, false}}, 3000, 10, 5000, 0xFFFFFF00u),
+                "HoldStart@1100/1000 HoldEnd@2500/2400 ");
+    expectTrace("millis wraparound, double",
+                replay(join({bouncy(200, true), bouncy(300, false), bouncy(450, true), bouncy(550, false)}), 1500, 1,
+                       5000, 0xFFFFFF00u),
+                "DoublePress@554/0 ");
+
+    // The long-hold time can change during a hold, as reset_hold_seconds can.
+    ButtonGestures g(10000);
+    for (uint32_t t = 0; t <= 4000; t += 10)
+    {
+        if (t == 2000)
+            g.setLongHoldMs(3000);
+        g.update(t >= 100, t);
+    }
+    ButtonEvent ev;
+    EXPECT(g.poll(ev) && ev.gesture == ButtonGesture::HoldStart);
+    EXPECT(g.poll(ev) && ev.gesture == ButtonGesture::LongHold && ev.heldMs == 3000);
+    EXPECT(g.holding() && g.heldMs(4000) == 3900);
+
+    return hostTestResult();
+}
@@ -0,0 +1,72 @@
+// parseRange() against the Range headers clients actually send, and the
+// malformed ones they should not.
+#include "file_range.h"
+#include "host_test.h"
+#include <stdio.h>
+
+// "full", "416" or "start+len".
+static std::string range(const char *header, size_t size)
+{
+    size_t start = 12345, len = 67890;
+    switch (parseRange(header, size, start, len))
+    {
+    case RangeResult::Full:
+        return "full";
+    case RangeResult::Unsatisfiable:
+        return "416";
+    default:
+        break;
+    }
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%u+%u", (unsigned)start, (unsigned)len);
+    return buf;
+}
+
+int main()
+{
+    // No header at all.
+    expectTrace("null", range(nullptr, 1000), "full");
+    expectTrace("empty", range("", 1000), "full");
+
+    // Closed ranges, clamped to the file.
+    expectTrace("first byte", range("bytes=0-0", 1000), "0+1");
+    expectTrace("first 500", range("bytes=0-499", 1000), "0+500");
+    expectTrace("middle", range("bytes=500-599", 1000), "500+100");
+    expectTrace("last byte", range("bytes=999-999", 1000), "999+1");
+    expectTrace("end past size", range("bytes=900-5000", 1000), "900+100");
+
+    // Open-ended: from start to the end.
+    expectTrace("open-ended", range("bytes=100-", 1000), "100+900");
+    expectTrace("open-ended, whole", range("bytes=0-", 1000), "0+1000");
+    expectTrace("open-ended, last byte", range("bytes=999-", 1000), "999+1");
+
+    // Suffix: the last N bytes, all of them when N is larger.
+    expectTrace("suffix", range("bytes=-100", 1000), "900+100");
+    expectTrace("suffix past size", range("bytes=-5000", 1000), "0+1000");
+    expectTrace("suffix zero", range("bytes=-0", 1000), "416");
+
+    // Start at or beyond the end.
+    expectTrace("start at size", range("bytes=1000-1100", 1000), "416");
+    expectTrace("open start at size", range("bytes=1000-", 1000), "416");
+    expectTrace("start beyond size", range("bytes=5000-", 1000), "416");
+    expectTrace("empty file", range("bytes=0-", 0), "416");
+    expectTrace("empty file, suffix", range("bytes=-10", 0), "416");
+
+    // Malformed: ignored, the whole file goes out with 200.
+    expectTrace("other unit", range("items=0-10", 1000), "full");
+    expectTrace("no dash", range("bytes=100", 1000), "full");
+    expectTrace("no numbers", range("bytes=-", 1000), "full");
+    expectTrace("reversed", range("bytes=500-100", 1000), "full");
+    expectTrace("trailing junk", range("bytes=0-10x", 1000), "full");
+    expectTrace("suffix junk", range("bytes=-10 ", 1000), "full");
+    expectTrace("negative start", range("bytes=--10", 1000), "full");
+    expectTrace("letters", range("bytes=a-b", 1000), "full");
+    expectTrace("overflow", range("bytes=99999999999999999999999-", 1000), "full");
+    expectTrace("uppercase unit", range("Bytes=0-10", 1000), "full");
+
+    // Multi-range requests fall back to 200 with the whole file.
+    expectTrace("multi-range", range("bytes=0-10,20-30", 1000), "full");
+    expectTrace("multi-range, suffix", range("bytes=-10,0-5", 1000), "full");
+
+    return hostTestResult();
+}
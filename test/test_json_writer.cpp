@@ -0,0 +1,129 @@
+// JsonWriter on the host: escaping, nesting and commas, overflow, and
+// streaming through a sink in buffer-sized chunks.
+#include "json_writer.h"
+#include "host_test.h"
+#include <string.h>
+#include <vector>
+
+struct Chunks
+{
+    std::vector<std::string> parts;
+    size_t failAfter = 0; // fail the nth call (1-based); 0: never
+};
+
+static bool collect(void *ctx, const char *data, size_t len)
+{
+    Chunks *c = static_cast<Chunks *>(ctx);
+    if (c->failAfter && c->parts.size() + 1 == c->failAfter)
+        return false;
+    c->parts.push_back(std::string(data, len));
+    return true;
+}
+
+static std::string joined(const Chunks &c)
+{
+    std::string all;
+    for (const std::string &p : c.parts)
+        all += p;
+    return all;
+}
+
+// The /status document shape, with an SSID that needs escaping.
+static void statusDoc(JsonWriter &w, const char *ssid)
+{
+    w.beginObject();
+    w.key("ssid").str(ssid);
+    w.key("devname").str("ThermaBridge");
+    w.key("rssi").numSigned(-61);
+    w.key("uptime_s").num(4294967295u);
+    w.key("up").boolean(true);
+    w.key("temp_f").null();
+    w.key("ip").raw("\"192.168.1.50\"");
+    w.key("tags").beginArray().str("a").num(1).beginObject().endObject().beginArray().endArray().endArray();
+    w.endObject();
+}
+
+static const char STATUS_JSON[] =
+    "{\"ssid\":\"my \\\"home\\\" \\\\ net\",\"devname\":\"ThermaBridge\",\"rssi\":-61,"
+    "\"uptime_s\":4294967295,\"up\":true,\"temp_f\":null,\"ip\":\"192.168.1.50\","
+    "\"tags\":[\"a\",1,{},[]]}";
+
+int main()
+{
+    char buf[256];
+
+    // Quotes and backslashes, the SSID bug this writer was written for.
+    {
+        JsonWriter w(buf, sizeof(buf));
+        statusDoc(w, "my \"home\" \\ net");
+        size_t n = w.finish();
+        expectTrace("escaped document", buf, STATUS_JSON);
+        EXPECT(n == strlen(STATUS_JSON) && w.ok());
+    }
+
+    // Control characters become \u00XX; UTF-8 passes through untouched.
+    {
+        JsonWriter w(buf, sizeof(buf));
+        w.beginArray().str("a\nb\tc\x01\x1f").str("caf\xc3\xa9").endArray();
+        w.finish();
+        expectTrace("control characters", buf, "[\"a\\u000ab\\u0009c\\u0001\\u001f\",\"caf\xc3\xa9\"]");
+    }
+
+    // Overflow: finish() returns 0 and leaves an empty string; a document
+    // that fits exactly (with its NUL) still succeeds.
+    {
+        const size_t need = strlen(STATUS_JSON) + 1;
+        std::vector<char> small(need - 1);
+        JsonWriter w(small.data(), small.size());
+        statusDoc(w, "my \"home\" \\ net");
+        EXPECT(w.finish() == 0 && !w.ok() && small[0] == '\0');
+
+        std::vector<char> exact(need);
+        JsonWriter x(exact.data(), exact.size());
+        statusDoc(x, "my \"home\" \\ net");
+        EXPECT(x.finish() == need - 1 && strcmp(exact.data(), STATUS_JSON) == 0);
+
+        JsonWriter z(buf, 0);
+        z.beginObject().endObject();
+        EXPECT(z.finish() == 0);
+    }
+
+    // Misuse fails instead of producing invalid JSON.
+    {
+        JsonWriter w(buf, sizeof(buf));
+        w.beginObject().endObject().endObject();
+        EXPECT(w.finish() == 0);
+        JsonWriter d(buf, sizeof(buf));
+        for (int i = 0; i < 40; i++)
+            d.beginArray();
+        EXPECT(d.finish() == 0);
+    }
+
+    // Sink mode: every chunk is a full buffer but the last, and together
+    // they are the same document; finish() returns the total length.
+    for (size_t cap = 1; cap <= 17; cap += 4)
+    {
+        Chunks c;
+        std::vector<char> small(cap);
+        JsonWriter w(small.data(), small.size(), collect, &c);
+        statusDoc(w, "my \"home\" \\ net");
+        size_t n = w.finish();
+        bool sizes = !c.parts.empty();
+        for (size_t i = 0; i + 1 < c.parts.size(); i++)
+            sizes = sizes && c.parts[i].size() == cap;
+        EXPECT(n == strlen(STATUS_JSON) && sizes);
+        expectTrace(("chunked, " + std::to_string(cap) + " byte buffer").c_str(), joined(c), STATUS_JSON);
+    }
+
+    // A sink that fails mid-document makes finish() return 0.
+    {
+        Chunks c;
+        c.failAfter = 3;
+        char small[16];
+        JsonWriter w(small, sizeof(small), collect, &c);
+        statusDoc(w, "x");
+        EXPECT(w.finish() == 0 && !w.ok() && c.parts.size() == 2);
+    }
+
+    return hostTestResult();
+}
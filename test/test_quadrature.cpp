@@ -0,0 +1,170 @@
+// Replays synthetic CLK/DT/SW edge traces, bounce included, through
+// QuadratureDecoder the way the RotaryEncoder ISR does: every edge passes all
+// three levels. Events print as "+", "-", "+N" for accelerated steps and "P".
+#include "quadrature.h"
+#include "host_test.h"
+#include <stdlib.h>
+#include <vector>
+
+struct Edge
+{
+    // 'c' CLK, 'd' DT, 's' SW (true = pressed); 'b' sets both lines to level
+    // and 'x' sets CLK to level and DT to its inverse in one read.
+    char pin;
+    bool level;
+    uint32_t atUs;
+};
+
+static std::string replay(const std::vector<Edge> &edges, bool accel = false)
+{
+    QuadratureDecoder d;
+    d.setAcceleration(accel);
+    bool clk = true, dt = true, sw = false; // idle: both lines high at a detent
+    int pos = 0;
+    std::string out;
+    for (const Edge &e : edges)
+    {
+        if (e.pin == 'c')
+            clk = e.level;
+        else if (e.pin == 'd')
+            dt = e.level;
+        else if (e.pin == 'b')
+            clk = dt = e.level;
+        else if (e.pin == 'x')
+        {
+            clk = e.level;
+            dt = !e.level;
+        }
+        else
+            sw = e.level;
+        EncoderEvent ev;
+        if (d.pins(clk, dt, e.atUs, ev))
+        {
+            pos += ev.delta;
+            if (ev.delta == 1 || ev.delta == -1)
+                out += ev.delta > 0 ? "+" : "-";
+            else
+                out += (ev.delta > 0 ? "+" : "-") + std::to_string(abs(ev.delta));
+        }
+        if (d.sw(sw, e.atUs, ev))
+            out += "P";
+    }
+    return out + " pos=" + std::to_string(pos);
+}
+
+// One detent from t: the leading line falls, the other follows, then both
+// return high, 2 ms apart. Clockwise, CLK leads. With bounce, every change
+// chatters `bounce` extra times 50 us apart before it settles.
+static void detent(std::vector<Edge> &v, uint32_t &t, bool cw, int bounce = 0)
+{
+    char first = cw ? 'c' : 'd', second = cw ? 'd' : 'c';
+    const Edge steps[] = {{first, false, 0}, {second, false, 0}, {first, true, 0}, {second, true, 0}};
+    for (const Edge &s : steps)
+    {
+        for (int b = 0; b < bounce; b++)
+        {
+            v.push_back({s.pin, s.level, t});
+            v.push_back({s.pin, !s.level, t + 25});
+            t += 50;
+        }
+        v.push_back({s.pin, s.level, t});
+        t += 2000;
+    }
+}
+
+int main()
+{
+    std::vector<Edge> v;
+    uint32_t t = 1000;
+
+    for (int i = 0; i < 5; i++)
+        detent(v, t, true);
+    expectTrace("clockwise", replay(v), "+++++ pos=5");
+
+    v.clear();
+    for (int i = 0; i < 3; i++)
+        detent(v, t, false);
+    expectTrace("counter-clockwise", replay(v), "--- pos=-3");
+
+    // Chatter on every transition within each detent still counts once.
+    v.clear();
+    for (int i = 0; i < 10; i++)
+        detent(v, t, i % 3 != 0, 3);
+    expectTrace("bounce within detents", replay(v), "-++-++-++- pos=2");
+
+    // Half a detent clockwise, then back the way it came.
+    v = {{'c', false, 100}, {'d', false, 2100}, {'d', true, 4100}, {'c', true, 6100}};
+    expectTrace("reversal mid-detent", replay(v), " pos=0");
+
+    // Turned back mid-detent, then a full counter-clockwise detent.
+    t = 8100;
+    detent(v, t, false);
+    expectTrace("reversal, then ccw detent", replay(v), "- pos=-1");
+
+    // Both lines change between two reads (a missed edge): 11 -> 00 -> 11
+    // and 11 -> 01 -> 10 -> 11 skip a Gray-code state and count nothing.
+    v = {{'b', false, 100}, {'b', true, 2100}};
+    expectTrace("two-bit jump 11-00-11", replay(v), " pos=0");
+    v = {{'c', false, 100}, {'x', true, 2100}, {'b', true, 4100}};
+    expectTrace("two-bit jump 01-10", replay(v), " pos=0");
+    // A clean detent right after an invalid jump still counts.
+    t = 6100;
+    detent(v, t, true);
+    expectTrace("detent after a two-bit jump", replay(v), "+ pos=1");
+
+    // Random chatter on CLK alone never completes a detent.
+    v.clear();
+    srand(1);
+    t = 100;
+    bool clk = true;
+    for (int i = 0; i < 500; i++)
+    {
+        clk = i == 499 ? true : (rand() & 1) != 0;
+        v.push_back({'c', clk, t});
+        t += 37;
+    }
+    expectTrace("chatter on one line", replay(v), " pos=0");
+
+    // Two presses, each with 7 toggles of chatter 300 us apart.
+    v.clear();
+    t = 5000000;
+    for (int p = 0; p < 2; p++)
+    {
+        for (int b = 0; b < 7; b++, t += 300)
+            v.push_back({'s', b % 2 == 0, t});
+        t += 80000;
+        for (int b = 0; b < 7; b++, t += 300)
+            v.push_back({'s', b % 2 != 0, t});
+        t += 100000;
+    }
+    expectTrace("bouncy presses", replay(v), "PP pos=0");
+
+    v.clear();
+    t = 100000;
+    detent(v, t, true);
+    v.push_back({'s', true, t - 1900});
+    expectTrace("press right after a turn", replay(v), "+P pos=1");
+
+    // Four slow detents, then four fast ones: the fast ones accelerate.
+    v.clear();
+    t = 1000;
+    for (int i = 0; i < 4; i++)
+    {
+        detent(v, t, true);
+        t += 100000;
+    }
+    for (int i = 0; i < 4; i++)
+    {
+        detent(v, t, true);
+        t += 2000;
+    }
+    expectTrace("acceleration", replay(v, true), "++++++8+8+8 pos=29");
+    expectTrace("acceleration off", replay(v, false), "++++++++ pos=8");
+
+    // A fast detent in the other direction is never scaled.
+    t += 2000;
+    detent(v, t, false);
+    expectTrace("acceleration, reversal", replay(v, true), "++++++8+8+8- pos=28");
+
+    return hostTestResult();
+}
@@ -0,0 +1,205 @@
+// Steps UiStateMachine with a fake millisecond clock: splash timeouts, the
+// menu, detail screens timing back to the menu, the screensaver and its
+// wake-up, and timers across the millis() wrap.
+#include "ui_state.h"
+#include "host_test.h"
+
+typedef UiScreen S;
+
+// Open a detail screen from the menu (cursor at item) at nowMs.
+static void openItem(UiStateMachine &ui, uint8_t item, uint32_t nowMs)
+{
+    ui.turn((int)item - (int)ui.menuIndex(), nowMs);
+    ui.select(nowMs);
+    ui.takeRedraw();
+}
+
+static void headless()
+{
+    // Splash, then the status screen after UI_SPLASH_MS; never a screensaver
+    // or a menu, and bound data (the uptime) does not force redraws.
+    UiStateMachine ui;
+    ui.begin(false, S::Splash, 1000);
+    EXPECT(ui.takeRedraw());
+    EXPECT(!ui.takeRedraw());
+    ui.tick(1000 + UI_SPLASH_MS - 1);
+    EXPECT(ui.screen() == S::Splash && !ui.takeRedraw());
+    ui.tick(1000 + UI_SPLASH_MS);
+    EXPECT(ui.screen() == S::Status && ui.takeRedraw());
+    int redraws = 0;
+    for (uint32_t t = 5000; t < 605000; t += 20)
+    {
+        ui.tick(t);
+        redraws += ui.takeRedraw();
+    }
+    EXPECT(ui.screen() == S::Status && redraws == 0);
+    ui.button(ButtonGesture::Press, 700000);
+    EXPECT(ui.screen() == S::Status && ui.takeRedraw());
+    ui.button(ButtonGesture::HoldStart, 700001);
+    EXPECT(!ui.takeRedraw());
+}
+
+static void splashToMenu()
+{
+    // With an encoder the splash waits for input; the waking turn opens the
+    // menu without moving the cursor.
+    UiStateMachine ui;
+    ui.begin(true, S::Splash, 0);
+    ui.takeRedraw();
+    ui.tick(UI_IDLE_MS - 1);
+    EXPECT(ui.screen() == S::Splash);
+    ui.turn(2, 10000);
+    EXPECT(ui.screen() == S::Menu && ui.menuIndex() == 0 && ui.takeRedraw());
+    ui.turn(1, 10100);
+    EXPECT(ui.menuIndex() == 1 && !ui.takeRedraw()); // the cursor is bound data
+    ui.turn(-3, 10200);
+    EXPECT(ui.menuIndex() == 2);
+    ui.turn(0, 10300);
+    EXPECT(!ui.takeRedraw());
+
+    // A press on the splash opens the menu too.
+    ui.begin(true, S::Splash, 0);
+    EXPECT(ui.select(500) == UiAction::None && ui.screen() == S::Menu);
+
+    // Nobody comes: the splash times out into the screensaver.
+    ui.begin(true, S::Splash, 0);
+    ui.tick(UI_IDLE_MS);
+    EXPECT(ui.screen() == S::Screensaver);
+}
+
+static void menu()
+{
+    UiStateMachine ui;
+    ui.begin(true, S::Menu, 0);
+    EXPECT(ui.select(100) == UiAction::None && ui.screen() == S::Status);
+    // A turn in a detail screen goes back with the cursor moved, a press as is.
+    ui.turn(1, 200);
+    EXPECT(ui.screen() == S::Menu && ui.menuIndex() == 1 && ui.takeRedraw());
+    ui.select(300);
+    EXPECT(ui.screen() == S::Config);
+    ui.select(400);
+    EXPECT(ui.screen() == S::Menu && ui.menuIndex() == 1);
+    ui.turn(2, 500);
+    EXPECT(ui.menuIndex() == 3);
+    EXPECT(ui.select(600) == UiAction::Reboot && ui.screen() == S::Menu);
+    ui.turn(1, 700);
+    EXPECT(ui.menuIndex() == 0); // wraps
+    EXPECT(std::string(uiMenuLabel(2)) == "Climate" && std::string(uiMenuLabel(9)).empty());
+}
+
+static void detailTimeouts()
+{
+    // Status, Config and Climate go back to the menu UI_DETAIL_MS after the
+    // last input, cursor kept; the screensaver follows at UI_IDLE_MS.
+    for (uint8_t item = 0; item < 3; item++)
+    {
+        UiStateMachine ui;
+        ui.begin(true, S::Menu, 0);
+        openItem(ui, item, 1000);
+        EXPECT(ui.screen() == (item == 0 ? S::Status : item == 1 ? S::Config : S::Climate));
+        ui.tick(1000 + UI_DETAIL_MS - 1);
+        EXPECT(ui.screen() != S::Menu && !ui.takeRedraw());
+        ui.tick(1000 + UI_DETAIL_MS);
+        EXPECT(ui.screen() == S::Menu && ui.menuIndex() == item && ui.takeRedraw());
+        ui.tick(1000 + UI_IDLE_MS - 1);
+        EXPECT(ui.screen() == S::Menu);
+        ui.tick(1000 + UI_IDLE_MS);
+        EXPECT(ui.screen() == S::Screensaver);
+    }
+
+    // Input restarts the timeout; BOOT activity counts as input.
+    UiStateMachine ui;
+    ui.begin(true, S::Menu, 0);
+    openItem(ui, 0, 1000);
+    ui.activity(15000);
+    ui.tick(1000 + UI_DETAIL_MS);
+    EXPECT(ui.screen() == S::Status);
+    ui.tick(15000 + UI_DETAIL_MS);
+    EXPECT(ui.screen() == S::Menu);
+
+    // Climate samples every UI_CLIMATE_REFRESH_MS until it times out.
+    ui.begin(true, S::Menu, 0);
+    openItem(ui, 2, 1000);
+    EXPECT(!ui.takeSample());
+    ui.tick(1000 + UI_CLIMATE_REFRESH_MS - 1);
+    EXPECT(!ui.takeSample());
+    ui.tick(1000 + UI_CLIMATE_REFRESH_MS);
+    EXPECT(ui.takeSample() && !ui.takeSample() && !ui.takeRedraw());
+    ui.tick(1000 + UI_DETAIL_MS);
+    EXPECT(ui.screen() == S::Menu && !ui.takeSample());
+}
+
+static void screensaver()
+{
+    UiStateMachine ui;
+    ui.begin(true, S::Menu, 0);
+    ui.takeRedraw();
+    ui.tick(UI_IDLE_MS - 1);
+    EXPECT(ui.screen() == S::Menu);
+    ui.tick(UI_IDLE_MS);
+    EXPECT(ui.screen() == S::Screensaver && ui.takeRedraw() && ui.saverStep() == 0);
+    ui.tick(UI_IDLE_MS + UI_SAVER_STEP_MS - 1);
+    EXPECT(!ui.takeRedraw());
+    ui.tick(UI_IDLE_MS + UI_SAVER_STEP_MS);
+    EXPECT(ui.takeRedraw() && ui.saverStep() == 1);
+
+    // The waking input only wakes: a press opens nothing, a turn moves nothing.
+    EXPECT(ui.select(40000) == UiAction::None && ui.screen() == S::Menu && ui.menuIndex() == 0);
+    ui.tick(40000 + UI_IDLE_MS);
+    ui.turn(1, 80000);
+    EXPECT(ui.screen() == S::Menu && ui.menuIndex() == 0);
+    ui.tick(80000 + UI_IDLE_MS);
+    ui.activity(120000);
+    EXPECT(ui.screen() == S::Menu);
+
+    // BOOT: DoublePress opens status from anywhere, Press the menu.
+    ui.button(ButtonGesture::DoublePress, 121000);
+    EXPECT(ui.screen() == S::Status);
+    ui.button(ButtonGesture::Press, 122000);
+    EXPECT(ui.screen() == S::Menu);
+    ui.invalidate();
+    ui.takeRedraw();
+    ui.invalidate();
+    EXPECT(ui.takeRedraw());
+}
+
+static void millisWrap()
+{
+    // Every timer counts across the 32-bit millis() wrap.
+    const uint32_t start = 0xFFFFF000u;
+    UiStateMachine ui;
+    ui.begin(false, S::Splash, start);
+    ui.tick(start + UI_SPLASH_MS - 1);
+    EXPECT(ui.screen() == S::Splash);
+    ui.tick(start + UI_SPLASH_MS);
+    EXPECT(ui.screen() == S::Status);
+
+    ui.begin(true, S::Splash, start);
+    ui.tick(start + UI_IDLE_MS - 1);
+    EXPECT(ui.screen() == S::Splash);
+    ui.tick(start + UI_IDLE_MS);
+    EXPECT(ui.screen() == S::Screensaver);
+    ui.takeRedraw();
+    ui.tick(start + UI_IDLE_MS + UI_SAVER_STEP_MS);
+    EXPECT(ui.takeRedraw() && ui.saverStep() == 1);
+
+    ui.begin(true, S::Menu, start);
+    openItem(ui, 2, start);
+    ui.tick(start + UI_CLIMATE_REFRESH_MS);
+    EXPECT(ui.takeSample());
+    ui.tick(start + UI_DETAIL_MS - 1);
+    EXPECT(ui.screen() == S::Climate);
+    ui.tick(start + UI_DETAIL_MS);
+    EXPECT(ui.screen() == S::Menu);
+}
+
+int main()
+{
+    headless();
+    splashToMenu();
+    menu();
+    detailTimeouts();
+    screensaver();
+    millisWrap();
+    return hostTestResult();
+}